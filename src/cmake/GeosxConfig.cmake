@@ -15,6 +15,7 @@ set( PREPROCESSOR_DEFINES ARRAY_BOUNDS_CHECK
                           CALIPER
                           CHAI
                           CUDA
+                          FE_GRADIENTS_ON_THE_FLY
                           FORTRAN_MANGLE_NO_UNDERSCORE
                           FPE
                           HYPRE
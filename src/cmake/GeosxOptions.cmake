@@ -37,6 +37,8 @@ option( ENABLE_VTK "Enables VTK" ON )
 
 option( ENABLE_TOTALVIEW_OUTPUT "Enables Totalview custom view" OFF )
 
+option( ENABLE_FE_GRADIENTS_ON_THE_FLY "Compute the shape function derivatives inside the finite element kernels instead of storing them" OFF )
+
 option( ENABLE_SUPERLU_DIST "Enables SUPERLU_DIST" ON )
 option( ENABLE_TRILINOS "Enables TRILINOS" ON )
 option( ENABLE_HYPRE "Enables HYPRE" ON )
@@ -67,7 +67,7 @@ BlackOilFluid::deliverClone( string const & name,
   clone = MultiFluidPVTPackageWrapper::deliverClone( name, parent );
   BlackOilFluid & fluid = dynamicCast< BlackOilFluid & >( *clone );
 
-  fluid.createFluid();
+  fluid.createFlashWorkspaces();
   return clone;
 }
 
@@ -95,7 +95,7 @@ void BlackOilFluid::PostProcessInput()
   #undef BOFLUID_CHECK_INPUT_LENGTH
 }
 
-void BlackOilFluid::createFluid()
+std::unique_ptr< PVTPackage::MultiphaseSystem > BlackOilFluid::createFluid() const
 {
   std::vector< PVTPackage::PHASE_TYPE > phases( m_phaseTypes.begin(), m_phaseTypes.end() );
   std::vector< std::string > tableFiles( m_tableFiles.begin(), m_tableFiles.end() );
@@ -106,19 +106,18 @@ void BlackOilFluid::createFluid()
   {
     case FluidType::LiveOil:
     {
-      m_fluid = std::make_unique< BlackOilMultiphaseSystem >( phases, tableFiles, densities, molarWeights );
-      break;
+      return std::make_unique< BlackOilMultiphaseSystem >( phases, tableFiles, densities, molarWeights );
     }
     case FluidType::DeadOil:
     {
-      m_fluid = std::make_unique< DeadOilMultiphaseSystem >( phases, tableFiles, densities, molarWeights );
-      break;
+      return std::make_unique< DeadOilMultiphaseSystem >( phases, tableFiles, densities, molarWeights );
     }
     default:
     {
       GEOSX_ERROR( "Unknown fluid type" );
     }
   }
+  return {};
 }
 
 REGISTER_CATALOG_ENTRY( ConstitutiveBase, BlackOilFluid, std::string const &, Group * const )
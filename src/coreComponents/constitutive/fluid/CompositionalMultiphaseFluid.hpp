@@ -58,7 +58,7 @@ protected:
 
 private:
 
-  void createFluid() override;
+  std::unique_ptr< PVTPackage::MultiphaseSystem > createFluid() const override;
 
   // names of equations of state to use for each phase
   string_array m_equationsOfState;
@@ -25,6 +25,10 @@
 
 #include <map>
 
+#if defined( GEOSX_USE_OPENMP )
+#include <omp.h>
+#endif
+
 namespace geosx
 {
 
@@ -35,8 +39,13 @@ namespace constitutive
 
 MultiFluidPVTPackageWrapper::MultiFluidPVTPackageWrapper( std::string const & name, Group * const parent )
   : MultiFluidBase( name, parent ),
-  m_fluid( nullptr )
-{}
+  m_useFlashCache( 0 )
+{
+  registerWrapper( viewKeyStruct::useFlashCacheString, &m_useFlashCache )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag indicating whether to reuse the previous flash of each cell when its inputs did not change" );
+}
 
 MultiFluidPVTPackageWrapper::~MultiFluidPVTPackageWrapper()
 {}
@@ -68,10 +77,88 @@ void MultiFluidPVTPackageWrapper::PostProcessInput()
                   []( string const & name ){ return getPVTPackagePhaseType( name ); } );
 }
 
+void MultiFluidPVTPackageWrapper::allocateConstitutiveData( dataRepository::Group * const parent,
+                                                            localIndex const numConstitutivePointsPerParentIndex )
+{
+  MultiFluidBase::allocateConstitutiveData( parent, numConstitutivePointsPerParentIndex );
+
+  if( m_useFlashCache )
+  {
+    localIndex const size = parent->size();
+    localIndex const numInputs = numFluidComponents() + 2;
+    m_flashCacheLastInputs.resize( size, numConstitutivePointsPerParentIndex, numInputs );
+    m_flashCacheIsValid.resize( size, numConstitutivePointsPerParentIndex );
+    m_flashCacheIsValid.setValues< serialPolicy >( 0 );
+  }
+}
+
 void MultiFluidPVTPackageWrapper::InitializePostSubGroups( Group * const group )
 {
   MultiFluidBase::InitializePostSubGroups( group );
-  createFluid();
+  m_workspaces.clear();
+  createFlashWorkspaces();
+}
+
+void MultiFluidPVTPackageWrapper::createFlashWorkspaces()
+{
+#if defined( GEOSX_USE_OPENMP )
+  localIndex const numThreads = omp_get_max_threads();
+#else
+  localIndex const numThreads = 1;
+#endif
+
+  // Workspaces are allocated ahead of the flashes, so that the flash itself does not touch the heap on our side.
+  // Missing ones are added when the number of threads has grown since the last call.
+  localIndex const numExisting = LvArray::integerConversion< localIndex >( m_workspaces.size() );
+  if( numThreads <= numExisting )
+  {
+    return;
+  }
+
+  m_workspaces.resize( numThreads );
+  for( localIndex i = numExisting; i < numThreads; ++i )
+  {
+    m_workspaces[i].fluid = createFluid();
+    m_workspaces[i].compMoleFrac.resize( numFluidComponents() );
+  }
+}
+
+PVTPackageFlashCache MultiFluidPVTPackageWrapper::createFlashCache()
+{
+  PVTPackageFlashCache cache;
+  cache.enabled = m_useFlashCache != 0;
+  cache.lastInputs = m_flashCacheLastInputs.toView();
+  cache.isValid = m_flashCacheIsValid.toView();
+  return cache;
+}
+
+localIndex MultiFluidPVTPackageWrapper::numFullFlashes() const
+{
+  localIndex count = 0;
+  for( PVTPackageFlashWorkspace const & workspace : m_workspaces )
+  {
+    count += workspace.numFullFlashes;
+  }
+  return count;
+}
+
+localIndex MultiFluidPVTPackageWrapper::numSkippedFlashes() const
+{
+  localIndex count = 0;
+  for( PVTPackageFlashWorkspace const & workspace : m_workspaces )
+  {
+    count += workspace.numSkippedFlashes;
+  }
+  return count;
+}
+
+void MultiFluidPVTPackageWrapper::resetFlashStatistics()
+{
+  for( PVTPackageFlashWorkspace & workspace : m_workspaces )
+  {
+    workspace.numFullFlashes = 0;
+    workspace.numSkippedFlashes = 0;
+  }
 }
 
 std::unique_ptr< ConstitutiveBase >
@@ -86,6 +173,68 @@ MultiFluidPVTPackageWrapper::deliverClone( string const & name,
   return clone;
 }
 
+PVTPackageFlashWorkspace & MultiFluidPVTPackageWrapperUpdate::getWorkspace() const
+{
+#if defined( GEOSX_USE_OPENMP )
+  localIndex const threadIndex = omp_get_thread_num();
+#else
+  localIndex const threadIndex = 0;
+#endif
+  GEOSX_ERROR_IF( threadIndex >= m_numWorkspaces,
+                  "No PVTPackage flash workspace for thread " << threadIndex << " (" << m_numWorkspaces << " available)" );
+  return m_workspaces[threadIndex];
+}
+
+bool MultiFluidPVTPackageWrapperUpdate::ReuseCachedFlash( localIndex const k,
+                                                          localIndex const q,
+                                                          real64 const pressure,
+                                                          real64 const temperature,
+                                                          arraySlice1d< real64 const > const & composition ) const
+{
+  // Points added after the cache was allocated are always flashed
+  if( k >= m_flashCache.isValid.size( 0 ) || m_flashCache.isValid[k][q] == 0 )
+  {
+    return false;
+  }
+
+  // Any change of the inputs, however small, may move the point across a phase boundary,
+  // which only the stability test of a full flash detects
+  arraySlice1d< real64 const > const lastInputs = m_flashCache.lastInputs[k][q];
+  if( pressure != lastInputs[0] || temperature != lastInputs[1] )
+  {
+    return false;
+  }
+  for( localIndex ic = 0; ic < numComponents(); ++ic )
+  {
+    if( composition[ic] != lastInputs[ic+2] )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+void MultiFluidPVTPackageWrapperUpdate::StoreCachedFlash( localIndex const k,
+                                                          localIndex const q,
+                                                          real64 const pressure,
+                                                          real64 const temperature,
+                                                          arraySlice1d< real64 const > const & composition ) const
+{
+  if( k >= m_flashCache.isValid.size( 0 ) )
+  {
+    return;
+  }
+
+  arraySlice1d< real64 > const lastInputs = m_flashCache.lastInputs[k][q];
+  lastInputs[0] = pressure;
+  lastInputs[1] = temperature;
+  for( localIndex ic = 0; ic < numComponents(); ++ic )
+  {
+    lastInputs[ic+2] = composition[ic];
+  }
+  m_flashCache.isValid[k][q] = 1;
+}
+
 void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
                                                  real64 temperature,
                                                  arraySlice1d< real64 const, 0 > const & composition,
@@ -99,7 +248,9 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   localIndex const NP = m_phaseTypes.size();
 
   // 1. Convert input mass fractions to mole fractions and keep derivatives
-  std::vector< double > compMoleFrac( NC );
+  PVTPackageFlashWorkspace & workspace = getWorkspace();
+  PVTPackage::MultiphaseSystem & fluid = *workspace.fluid;
+  std::vector< double > & compMoleFrac = workspace.compMoleFrac;
 
   if( m_useMass )
   {
@@ -125,17 +276,17 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   }
 
   // 2. Trigger PVTPackage compute and get back phase split
-  m_fluid.Update( pressure, temperature, compMoleFrac );
+  fluid.Update( pressure, temperature, compMoleFrac );
 
-  GEOSX_WARNING_IF( m_fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
+  GEOSX_WARNING_IF( fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
                     "Phase equilibrium calculations not converged" );
 
-  PVTPackage::MultiphaseSystemProperties const & split = m_fluid.get_MultiphaseSystemProperties();
+  PVTPackage::MultiphaseSystemProperties const & split = fluid.get_MultiphaseSystemProperties();
 
   // 3. Extract phase split and phase properties from PVTPackage
   for( localIndex ip = 0; ip < NP; ++ip )
   {
-    PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+    PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
     auto const & frac = split.PhaseMoleFraction.at( m_phaseTypes[ip] );
     auto const & comp = props.MoleComposition;
     auto const & dens = m_useMass ? props.MassDensity : props.MoleDensity;
@@ -158,7 +309,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.1.1. Compute mass of each phase and total mass (on a 1-mole basis)
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
       auto const & phaseMW = props.MolecularWeight;
       phaseFrac[ip] *= phaseMW.value;
       totalMass += phaseFrac[ip];
@@ -174,7 +325,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.2. Convert phase compositions
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
       real64 const phaseMWInv = 1.0 / props.MolecularWeight.value;
 
       for( localIndex ic = 0; ic < NC; ++ic )
@@ -270,7 +421,9 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
 
   // 1. Convert input mass fractions to mole fractions and keep derivatives
 
-  std::vector< double > compMoleFrac( NC );
+  PVTPackageFlashWorkspace & workspace = getWorkspace();
+  PVTPackage::MultiphaseSystem & fluid = *workspace.fluid;
+  std::vector< double > & compMoleFrac = workspace.compMoleFrac;
   stackArray2d< real64, maxNumComp * maxNumComp > dCompMoleFrac_dCompMassFrac( NC, NC );
 
   if( m_useMass )
@@ -308,17 +461,17 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
   }
 
   // 2. Trigger PVTPackage compute and get back phase split
-  m_fluid.Update( pressure, temperature, compMoleFrac );
+  fluid.Update( pressure, temperature, compMoleFrac );
 
-  GEOSX_WARNING_IF( m_fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
+  GEOSX_WARNING_IF( fluid.getState() != PVTPackage::MultiphaseSystem::State::SUCCESS,
                     "Phase equilibrium calculations not converged" );
 
-  PVTPackage::MultiphaseSystemProperties const & split = m_fluid.get_MultiphaseSystemProperties();
+  PVTPackage::MultiphaseSystemProperties const & split = fluid.get_MultiphaseSystemProperties();
 
   // 3. Extract phase split, phase properties and derivatives from PVTPackage
   for( localIndex ip = 0; ip < NP; ++ip )
   {
-    PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+    PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
 
     auto const & frac = split.PhaseMoleFraction.at( m_phaseTypes[ip] );
     auto const & comp = props.MoleComposition;
@@ -364,7 +517,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.1.1. Compute mass of each phase and total mass (on a 1-mole basis)
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
 
       auto const & phaseMW = props.MolecularWeight;
       real64 const nu = phaseFrac.value[ip];
@@ -401,7 +554,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     // 4.2. Convert phase compositions
     for( localIndex ip = 0; ip < NP; ++ip )
     {
-      PVTPackage::PhaseProperties const & props = m_fluid.get_PhaseProperties( m_phaseTypes[ip] );
+      PVTPackage::PhaseProperties const & props = fluid.get_PhaseProperties( m_phaseTypes[ip] );
 
       auto const & phaseMW = props.MolecularWeight;
       real64 const phaseMWInv = 1.0 / phaseMW.value;
@@ -426,7 +579,7 @@ void MultiFluidPVTPackageWrapperUpdate::Compute( real64 pressure,
     }
 
     // 4.3. Update derivatives w.r.t. mole fractions to derivatives w.r.t mass fractions
-    array1d< real64 > work( NC );
+    stackArray1d< real64, maxNumComp > work( NC );
     for( localIndex ip = 0; ip < NP; ++ip )
     {
       applyChainRuleInPlace( NC, dCompMoleFrac_dCompMassFrac, phaseFrac.dComp[ip], work );
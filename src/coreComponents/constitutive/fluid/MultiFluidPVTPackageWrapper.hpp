@@ -22,6 +22,7 @@
 #include "constitutive/fluid/MultiFluidBase.hpp"
 
 #include <memory>
+#include <vector>
 
 namespace PVTPackage
 {
@@ -35,15 +36,53 @@ namespace geosx
 namespace constitutive
 {
 
+/**
+ * @brief Flash workspace used by a single host thread.
+ *
+ * PVTPackage fluid objects store the results of the last flash internally,
+ * therefore each thread performing property updates needs its own copy.
+ */
+struct PVTPackageFlashWorkspace
+{
+  /// PVTPackage fluid object
+  std::unique_ptr< PVTPackage::MultiphaseSystem > fluid;
+
+  /// Buffer for component mole fractions passed to PVTPackage
+  std::vector< double > compMoleFrac;
+
+  /// Number of flashes performed by PVTPackage
+  localIndex numFullFlashes = 0;
+
+  /// Number of flashes skipped thanks to the flash cache
+  localIndex numSkippedFlashes = 0;
+};
+
+/**
+ * @brief Views of the per-point flash cache used to skip unnecessary flashes.
+ */
+struct PVTPackageFlashCache
+{
+  /// Whether the cache is used at all
+  bool enabled = false;
+
+  /// Inputs (pressure, temperature, composition) of the last full flash
+  arrayView3d< real64 > lastInputs;
+
+  /// Whether a full flash is stored (1) or not (0)
+  arrayView2d< integer > isValid;
+};
+
 /**
  * @brief Kernel wrapper class for MultiFluidPVTPackage.
- * @note Not thread-safe, do not use with any parallel launch policy.
+ * @note Thread-safe on host (each thread flashes in its own workspace), not device-capable.
  */
 class MultiFluidPVTPackageWrapperUpdate final : public MultiFluidBaseUpdate
 {
 public:
 
-  MultiFluidPVTPackageWrapperUpdate( PVTPackage::MultiphaseSystem & fluid,
+  MultiFluidPVTPackageWrapperUpdate( PVTPackageFlashWorkspace * const workspaces,
+                                     localIndex const numWorkspaces,
+                                     PVTPackageFlashCache const & flashCache,
                                      arrayView1d< PVTPackage::PHASE_TYPE > const & phaseTypes,
                                      arrayView1d< real64 const > const & componentMolarWeight,
                                      bool useMass,
@@ -89,7 +128,9 @@ public:
                             dTotalDensity_dPressure,
                             dTotalDensity_dTemperature,
                             dTotalDensity_dGlobalCompFraction ),
-    m_fluid( fluid ),
+    m_workspaces( workspaces ),
+    m_numWorkspaces( numWorkspaces ),
+    m_flashCache( flashCache ),
     m_phaseTypes( phaseTypes )
   {}
 
@@ -145,6 +186,12 @@ public:
                        real64 const temperature,
                        arraySlice1d< real64 const > const & composition ) const override
   {
+    if( m_flashCache.enabled && ReuseCachedFlash( k, q, pressure, temperature, composition ) )
+    {
+      ++getWorkspace().numSkippedFlashes;
+      return;
+    }
+
     Compute( pressure,
              temperature,
              composition,
@@ -168,11 +215,61 @@ public:
              m_dTotalDensity_dPressure[k][q],
              m_dTotalDensity_dTemperature[k][q],
              m_dTotalDensity_dGlobalCompFraction[k][q] );
+
+    ++getWorkspace().numFullFlashes;
+    if( m_flashCache.enabled )
+    {
+      StoreCachedFlash( k, q, pressure, temperature, composition );
+    }
   }
 
 private:
 
-  PVTPackage::MultiphaseSystem & m_fluid;
+  /**
+   * @brief Try to obtain fluid properties at a point without performing a flash.
+   * @param k element index
+   * @param q quadrature point index
+   * @param pressure new pressure
+   * @param temperature new temperature
+   * @param composition new global component fractions
+   * @return true if the stored properties have been reused
+   *
+   * Properties are only reused if the inputs are identical to those they were computed with.
+   */
+  bool ReuseCachedFlash( localIndex const k,
+                         localIndex const q,
+                         real64 const pressure,
+                         real64 const temperature,
+                         arraySlice1d< real64 const > const & composition ) const;
+
+  /**
+   * @brief Record the inputs of a full flash at a point.
+   * @param k element index
+   * @param q quadrature point index
+   * @param pressure pressure
+   * @param temperature temperature
+   * @param composition global component fractions
+   */
+  void StoreCachedFlash( localIndex const k,
+                         localIndex const q,
+                         real64 const pressure,
+                         real64 const temperature,
+                         arraySlice1d< real64 const > const & composition ) const;
+
+  /**
+   * @brief Get the flash workspace of the calling thread.
+   * @return the workspace
+   */
+  PVTPackageFlashWorkspace & getWorkspace() const;
+
+  /// Per-thread flash workspaces
+  PVTPackageFlashWorkspace * m_workspaces;
+
+  /// Number of flash workspaces
+  localIndex m_numWorkspaces;
+
+  /// Per-point flash cache
+  PVTPackageFlashCache m_flashCache;
 
   arrayView1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
 
@@ -190,16 +287,48 @@ public:
   deliverClone( string const & name,
                 Group * const parent ) const override;
 
+  virtual void allocateConstitutiveData( dataRepository::Group * const parent,
+                                         localIndex const numConstitutivePointsPerParentIndex ) override;
+
+  /**
+   * @brief Get the number of flashes performed by PVTPackage since the last reset.
+   * @return the number of full flashes
+   */
+  localIndex numFullFlashes() const;
+
+  /**
+   * @brief Get the number of flashes skipped thanks to the flash cache since the last reset.
+   * @return the number of skipped flashes
+   */
+  localIndex numSkippedFlashes() const;
+
+  /**
+   * @brief Reset flash statistics counters.
+   */
+  void resetFlashStatistics();
+
+  struct viewKeyStruct : MultiFluidBase::viewKeyStruct
+  {
+    static constexpr auto useFlashCacheString = "useFlashCache";
+  };
+
   /// Type of kernel wrapper for in-kernel update
   using KernelWrapper = MultiFluidPVTPackageWrapperUpdate;
 
+  /// Launch policy for property updates (kernel wrapper is thread-safe on host)
+  using UpdatePolicy = parallelHostPolicy;
+
   /**
    * @brief Create an update kernel wrapper.
    * @return the wrapper
    */
   KernelWrapper createKernelWrapper()
   {
-    return KernelWrapper( *m_fluid,
+    // the number of threads may have been raised since initialization
+    createFlashWorkspaces();
+    return KernelWrapper( m_workspaces.data(),
+                          LvArray::integerConversion< localIndex >( m_workspaces.size() ),
+                          createFlashCache(),
                           m_phaseTypes,
                           m_componentMolarWeight,
                           m_useMass,
@@ -231,14 +360,35 @@ protected:
 
   virtual void InitializePostSubGroups( Group * const group ) override;
 
-  /// function that populates m_fluid ptr; to be overriden by derived classes
-  virtual void createFluid() = 0;
+  /**
+   * @brief Create a new PVTPackage fluid object; to be overriden by derived classes.
+   * @return the fluid object
+   */
+  virtual std::unique_ptr< PVTPackage::MultiphaseSystem > createFluid() const = 0;
 
-  /// PVTPackage fluid object
-  std::unique_ptr< PVTPackage::MultiphaseSystem > m_fluid;
+  /// Populate the flash workspaces, one per host thread, adding the missing ones if the thread count has grown
+  void createFlashWorkspaces();
+
+  /**
+   * @brief Create views of the flash cache for the kernel wrapper.
+   * @return the flash cache views
+   */
+  PVTPackageFlashCache createFlashCache();
+
+  /// Per-thread flash workspaces
+  std::vector< PVTPackageFlashWorkspace > m_workspaces;
 
   /// PVTPackage phase labels
   array1d< PVTPackage::PHASE_TYPE > m_phaseTypes;
+
+  /// Flag indicating whether flashes may be skipped based on the previous flash at each point
+  integer m_useFlashCache;
+
+  /// Inputs (pressure, temperature, composition) of the last full flash at each point
+  array3d< real64 > m_flashCacheLastInputs;
+
+  /// Whether a full flash is stored at each point
+  array2d< integer > m_flashCacheIsValid;
 };
 
 } //namespace constitutive
@@ -209,6 +209,9 @@ public:
   /// Type of kernel wrapper for in-kernel update
   using KernelWrapper = MultiPhaseMultiComponentFluidUpdate;
 
+  /// Launch policy for property updates (kernel wrapper is not thread-safe)
+  using UpdatePolicy = serialPolicy;
+
   /**
    * @brief Create an update kernel wrapper.
    * @return the wrapper
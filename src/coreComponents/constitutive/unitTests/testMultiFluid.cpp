@@ -356,6 +356,89 @@ TEST_F( CompositionalFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol );
 }
 
+TEST_F( CompositionalFluidTest, parallelUpdate )
+{
+  localIndex constexpr numElems = 64;
+  parent->resize( numElems );
+  fluid->allocateConstitutiveData( parent.get(), 1 );
+
+  array1d< real64 > pres( numElems );
+  array2d< real64 > comp( numElems, 4 );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    pres[k] = 4e6 + 5e4 * k;
+    comp[k][0] = 0.099; comp[k][1] = 0.3; comp[k][2] = 0.6; comp[k][3] = 0.001;
+  }
+  real64 const T = 297.15;
+
+  arrayView1d< real64 const > const presView = pres.toViewConst();
+  arrayView2d< real64 const > const compView = comp.toViewConst();
+
+  // flash all elements in parallel, each thread using its own workspace
+  constitutive::constitutiveUpdatePassThru( *fluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    forAll< typename TYPEOFREF( castedFluid ) ::UpdatePolicy >( numElems, [=] ( localIndex const k )
+    {
+      fluidWrapper.Update( k, 0, presView[k], T, compView[k] );
+    } );
+  } );
+
+  array1d< real64 > totalDensParallel( numElems );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    totalDensParallel[k] = fluid->totalDensity()[k][0];
+  }
+
+  // repeat serially and compare
+  constitutive::constitutiveUpdatePassThru( *fluid, [&] ( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    for( localIndex k = 0; k < numElems; ++k )
+    {
+      fluidWrapper.Update( k, 0, presView[k], T, compView[k] );
+    }
+  } );
+
+  arrayView2d< real64 const > const & totalDens = fluid->totalDensity();
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    EXPECT_DOUBLE_EQ( totalDensParallel[k], totalDens[k][0] );
+  }
+}
+
+TEST_F( CompositionalFluidTest, flashCache )
+{
+  MultiFluidPVTPackageWrapper & pvtFluid = dynamicCast< MultiFluidPVTPackageWrapper & >( *fluid );
+  pvtFluid.getReference< integer >( MultiFluidPVTPackageWrapper::viewKeyStruct::useFlashCacheString ) = 1;
+  fluid->allocateConstitutiveData( parent.get(), 1 );
+  pvtFluid.resetFlashStatistics();
+
+  real64 const P = 5e6;
+  real64 const T = 297.15;
+  array1d< real64 > comp( 4 );
+  comp[0] = 0.099; comp[1] = 0.3; comp[2] = 0.6; comp[3] = 0.001;
+
+  MultiFluidPVTPackageWrapper::KernelWrapper fluidWrapper = pvtFluid.createKernelWrapper();
+
+  // first update always flashes
+  fluidWrapper.Update( 0, 0, P, T, comp );
+  real64 const totalDens = fluid->totalDensity()[0][0];
+  EXPECT_EQ( pvtFluid.numFullFlashes(), 1 );
+  EXPECT_EQ( pvtFluid.numSkippedFlashes(), 0 );
+
+  // identical inputs reuse stored properties
+  fluidWrapper.Update( 0, 0, P, T, comp );
+  EXPECT_EQ( pvtFluid.numFullFlashes(), 1 );
+  EXPECT_EQ( pvtFluid.numSkippedFlashes(), 1 );
+  EXPECT_DOUBLE_EQ( fluid->totalDensity()[0][0], totalDens );
+
+  // changed inputs trigger a new flash
+  fluidWrapper.Update( 0, 0, 1.01 * P, T, comp );
+  EXPECT_EQ( pvtFluid.numFullFlashes(), 2 );
+  EXPECT_EQ( pvtFluid.numSkippedFlashes(), 1 );
+}
+
 MultiFluidBase * makeLiveOilFluid( string const & name, Group * parent )
 {
   auto fluid = parent->RegisterGroup< BlackOilFluid >( name );
@@ -498,6 +581,57 @@ TEST_F( LiveOilFluidTest, numericalDerivativesMass )
   testNumericalDerivatives( *fluid, P, T, comp, eps, relTol, absTol );
 }
 
+TEST_F( LiveOilFluidTest, flashCacheAcrossBubblePoint )
+{
+  MultiFluidPVTPackageWrapper & pvtFluid = dynamicCast< MultiFluidPVTPackageWrapper & >( *fluid );
+  pvtFluid.getReference< integer >( MultiFluidPVTPackageWrapper::viewKeyStruct::useFlashCacheString ) = 1;
+  fluid->allocateConstitutiveData( parent.get(), 1 );
+  pvtFluid.resetFlashStatistics();
+
+  // the gas/oil ratio of this composition gives a bubble point of about 10 MPa
+  real64 const highP = 3e7;
+  real64 const lowP = 3e6;
+  real64 const T = 297.15;
+  array1d< real64 > comp( 3 );
+  comp[0] = 0.3; comp[1] = 0.0265; comp[2] = 0.6735;
+  localIndex const ipGas = 1;
+
+  MultiFluidPVTPackageWrapper::KernelWrapper fluidWrapper = pvtFluid.createKernelWrapper();
+
+  // above the bubble point all the gas is dissolved in the oil
+  fluidWrapper.Update( 0, 0, highP, T, comp );
+  fluidWrapper.Update( 0, 0, highP, T, comp );
+  EXPECT_EQ( pvtFluid.numFullFlashes(), 1 );
+  EXPECT_EQ( pvtFluid.numSkippedFlashes(), 1 );
+  EXPECT_DOUBLE_EQ( fluid->phaseFraction()[0][0][ipGas], 0.0 );
+
+  // below the bubble point the cached single-phase state must not be reused
+  fluidWrapper.Update( 0, 0, lowP, T, comp );
+  EXPECT_EQ( pvtFluid.numFullFlashes(), 2 );
+  EXPECT_EQ( pvtFluid.numSkippedFlashes(), 1 );
+  EXPECT_GT( fluid->phaseFraction()[0][0][ipGas], 0.0 );
+
+  array1d< real64 > cachedPhaseFrac( fluid->numFluidPhases() );
+  array1d< real64 > cachedPhaseDens( fluid->numFluidPhases() );
+  for( localIndex ip = 0; ip < fluid->numFluidPhases(); ++ip )
+  {
+    cachedPhaseFrac[ip] = fluid->phaseFraction()[0][0][ip];
+    cachedPhaseDens[ip] = fluid->phaseDensity()[0][0][ip];
+  }
+  real64 const cachedTotalDens = fluid->totalDensity()[0][0];
+
+  // the result is the one of a flash without cache
+  pvtFluid.getReference< integer >( MultiFluidPVTPackageWrapper::viewKeyStruct::useFlashCacheString ) = 0;
+  MultiFluidPVTPackageWrapper::KernelWrapper uncachedWrapper = pvtFluid.createKernelWrapper();
+  uncachedWrapper.Update( 0, 0, lowP, T, comp );
+  for( localIndex ip = 0; ip < fluid->numFluidPhases(); ++ip )
+  {
+    EXPECT_DOUBLE_EQ( fluid->phaseFraction()[0][0][ip], cachedPhaseFrac[ip] );
+    EXPECT_DOUBLE_EQ( fluid->phaseDensity()[0][0][ip], cachedPhaseDens[ip] );
+  }
+  EXPECT_DOUBLE_EQ( fluid->totalDensity()[0][0], cachedTotalDens );
+}
+
 class DeadOilFluidTest : public ::testing::Test
 {
 protected:
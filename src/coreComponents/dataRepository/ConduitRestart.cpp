@@ -24,6 +24,13 @@
 
 // TPL includes
 #include <conduit_relay.hpp>
+#include <conduit_relay_io_hdf5.hpp>
+#include <H5public.h>
+
+// System includes
+#include <cstring>
+#include <future>
+#include <limits>
 
 namespace geosx
 {
@@ -32,81 +39,465 @@ namespace dataRepository
 
 conduit::Node rootConduitNode;
 
+namespace
+{
+
+/// The restart write running on a background thread, if any
+std::future< void > pendingWrite;
+
+/// Key under the root node holding the name of the base restart of a delta restart
+constexpr char const restartBaseKey[] = "__restartBase__";
+
+/// Key marking a node of a delta restart whose content is in the base restart
+constexpr char const unchangedKey[] = "__unchangedSinceBase__";
+
+// Primes of the xxHash64 algorithm
+std::uint64_t constexpr hashPrime1 = 11400714785074694791ULL;
+std::uint64_t constexpr hashPrime2 = 14029467366897019727ULL;
+std::uint64_t constexpr hashPrime3 = 1609587929392839161ULL;
+std::uint64_t constexpr hashPrime4 = 9650029242287828579ULL;
+std::uint64_t constexpr hashPrime5 = 2870177450012600261ULL;
+
+std::uint64_t rotateLeft( std::uint64_t const x, int const r )
+{
+  return ( x << r ) | ( x >> ( 64 - r ) );
+}
+
+// Mixes the input into the hash with the rounds of xxHash64, each bit of the input reaches the whole hash through
+// the rotations and multiplications, so that flipping the same bit of several words does not cancel out.
+std::uint64_t hashBytes( std::uint64_t hash, void const * const data, std::size_t const numBytes )
+{
+  unsigned char const * const bytes = static_cast< unsigned char const * >( data );
+
+  std::size_t const numWords = numBytes / sizeof( std::uint64_t );
+  for( std::size_t i = 0; i < numWords; ++i )
+  {
+    std::uint64_t word;
+    std::memcpy( &word, bytes + i * sizeof( std::uint64_t ), sizeof( std::uint64_t ) );
+    hash ^= rotateLeft( word * hashPrime2, 31 ) * hashPrime1;
+    hash = rotateLeft( hash, 27 ) * hashPrime1 + hashPrime4;
+  }
+  for( std::size_t i = numWords * sizeof( std::uint64_t ); i < numBytes; ++i )
+  {
+    hash ^= bytes[ i ] * hashPrime5;
+    hash = rotateLeft( hash, 11 ) * hashPrime1;
+  }
+  return hash;
+}
+
+// The final avalanche of xxHash64
+std::uint64_t hashFinalize( std::uint64_t hash )
+{
+  hash ^= hash >> 33;
+  hash *= hashPrime2;
+  hash ^= hash >> 29;
+  hash *= hashPrime3;
+  hash ^= hash >> 32;
+  return hash;
+}
+
+std::uint64_t hashNode( std::uint64_t hash, conduit::Node const & node )
+{
+  conduit::index_t const numChildren = node.number_of_children();
+  if( numChildren > 0 )
+  {
+    for( conduit::index_t i = 0; i < numChildren; ++i )
+    {
+      hash = hashNode( hash, node.child( i ) );
+    }
+    return hash;
+  }
+
+  std::uint64_t const header[ 2 ] = { static_cast< std::uint64_t >( node.dtype().id() ),
+                                      static_cast< std::uint64_t >( node.total_bytes_compact() ) };
+  hash = hashBytes( hash, header, sizeof( header ) );
+
+  if( node.dtype().is_empty() )
+  {
+    return hash;
+  }
+
+  if( node.is_compact() )
+  {
+    return hashBytes( hash, node.data_ptr(), node.total_bytes_compact() );
+  }
+
+  conduit::Node compact;
+  node.compact_to( compact );
+  return hashBytes( hash, compact.data_ptr(), compact.total_bytes_compact() );
+}
+
+void fillUnchangedFromBase( conduit::Node & node, conduit::Node const * const base )
+{
+  if( node.has_child( unchangedKey ) )
+  {
+    GEOSX_ERROR_IF( base == nullptr, "Delta restart entry " << node.path() << " is missing from the base restart." );
+    node.set( *base );
+    return;
+  }
+
+  for( conduit::index_t i = 0; i < node.number_of_children(); ++i )
+  {
+    conduit::Node & child = node.child( i );
+    conduit::Node const * const baseChild = ( base != nullptr && base->has_child( child.name() ) ) ? &base->fetch_child( child.name() ) : nullptr;
+    fillUnchangedFromBase( child, baseChild );
+  }
+}
+
+/// MPI tag of the messages sending the rank trees to the rank writing their file
+int constexpr aggregationTag = 1492;
+
+/// Whether the trees of several ranks are written to each restart file
+bool isAggregated( int const numFiles )
+{
+  return numFiles > 0 && numFiles < MpiWrapper::Comm_size();
+}
+
+/// Index of the file holding the tree of @p rank when @p numRanks trees are split over @p numFiles files
+int fileIndexOfRank( int const rank, int const numRanks, int const numFiles )
+{
+  return static_cast< int >( static_cast< long long >( rank ) * numFiles / numRanks );
+}
+
+/// Lowest rank whose tree is in file @p fileIndex, which is the rank writing that file
+int firstRankOfFile( int const fileIndex, int const numRanks, int const numFiles )
+{
+  return static_cast< int >( ( static_cast< long long >( fileIndex ) * numRanks + numFiles - 1 ) / numFiles );
+}
+
+std::string formatRestartPath( char const * const pattern, std::string const & rootPath, int const index )
+{
+  std::vector< char > buffer( rootPath.size() + 64 );
+  int const length = std::snprintf( buffer.data(), buffer.size(), pattern, rootPath.data(), index );
+  GEOSX_ERROR_IF( length < 0 || length >= static_cast< int >( buffer.size() ), "Restart file path is too long" );
+  return buffer.data();
+}
+
+std::string treeName( int const rank )
+{
+  char buffer[ 32 ];
+  std::snprintf( buffer, 32, "rank_%07d", rank );
+  return buffer;
+}
+
+/**
+ * @brief Gather the trees of the ranks sharing a restart file on the rank that writes it.
+ * @param tree the tree of this rank
+ * @param numFiles the number of restart files
+ * @param fileTree on the writing rank, set to hold one child per rank of the file
+ * @param receivedTrees on the writing rank, the storage for the trees received from the other ranks
+ * @return whether this rank writes a file
+ */
+bool gatherFileTree( conduit::Node & tree,
+                     int const numFiles,
+                     conduit::Node & fileTree,
+                     std::vector< conduit::Node > & receivedTrees )
+{
+  GEOSX_MARK_FUNCTION;
+
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+  int const fileIndex = fileIndexOfRank( rank, size, numFiles );
+  int const writer = firstRankOfFile( fileIndex, size, numFiles );
+  int const nextWriter = firstRankOfFile( fileIndex + 1, size, numFiles );
+
+  if( rank != writer )
+  {
+    // send the compact schema followed by the compact data
+    conduit::Schema schema;
+    tree.schema().compact_to( schema );
+    std::string const schemaJSON = schema.to_json();
+    std::vector< conduit::uint8 > data;
+    tree.serialize( data );
+
+    // the message is sent with an int count
+    std::size_t const messageSize = sizeof( localIndex ) + schemaJSON.size() + data.size();
+    GEOSX_ERROR_IF( messageSize > static_cast< std::size_t >( std::numeric_limits< int >::max() ),
+                    "Restart tree of rank " << rank << " (" << messageSize << " bytes) is too large to be sent "
+                    "to the rank writing its file, use more restart files (numFiles)." );
+
+    localIndex const schemaSize = LvArray::integerConversion< localIndex >( schemaJSON.size() );
+    array1d< char > message( messageSize );
+    std::memcpy( message.data(), &schemaSize, sizeof( localIndex ) );
+    std::memcpy( message.data() + sizeof( localIndex ), schemaJSON.data(), schemaJSON.size() );
+    std::memcpy( message.data() + sizeof( localIndex ) + schemaJSON.size(), data.data(), data.size() );
+
+    MPI_Request request;
+    MpiWrapper::iSend( message.toViewConst(), writer, aggregationTag, MPI_COMM_GEOSX, &request );
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+    return false;
+  }
+
+  fileTree[ treeName( rank ) ].set_external( tree );
+
+  receivedTrees.resize( nextWriter - writer - 1 );
+  for( int sender = writer + 1; sender < nextWriter; ++sender )
+  {
+    array1d< char > message;
+    MpiWrapper::recv( message, sender, aggregationTag, MPI_COMM_GEOSX, MPI_STATUS_IGNORE );
+
+    localIndex schemaSize;
+    std::memcpy( &schemaSize, message.data(), sizeof( localIndex ) );
+    conduit::Schema const schema( std::string( message.data() + sizeof( localIndex ), schemaSize ) );
+
+    conduit::Node & received = receivedTrees[ sender - writer - 1 ];
+    received.set_data_using_schema( schema, message.data() + sizeof( localIndex ) + schemaSize );
+    fileTree[ treeName( sender ) ].set_external( received );
+  }
+  return true;
+}
+
+}
+
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath )
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, int const numFiles )
 {
   std::string rootDirName, rootFileName;
   splitPath( rootPath, rootDirName, rootFileName );
 
-  if( MpiWrapper::Comm_rank() == 0 )
+  int const rank = MpiWrapper::Comm_rank();
+  int const size = MpiWrapper::Comm_size();
+  bool const aggregated = isAggregated( numFiles );
+
+  if( rank == 0 )
   {
     makeDirsForPath( rootPath );
 
     root[ "protocol/name" ] = "hdf5";
     root[ "protocol/version" ] = CONDUIT_VERSION;
 
-    root[ "number_of_files" ] = MpiWrapper::Comm_size();
-    root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+    if( aggregated )
+    {
+      // the trees of consecutive ranks are grouped in files, see fileIndexOfRank()
+      root[ "number_of_files" ] = numFiles;
+      root[ "file_pattern" ] = rootFileName + "/file_%07d.hdf5";
 
-    root[ "number_of_trees" ] = 1;
-    root[ "tree_pattern" ] = "/";
+      root[ "number_of_trees" ] = size;
+      root[ "tree_pattern" ] = "rank_%07d";
+    }
+    else
+    {
+      root[ "number_of_files" ] = size;
+      root[ "file_pattern" ] = rootFileName + "/rank_%07d.hdf5";
+
+      root[ "number_of_trees" ] = 1;
+      root[ "tree_pattern" ] = "/";
+    }
 
     conduit::relay::io::save( root, rootPath + ".root", "hdf5" );
   }
 
   MpiWrapper::Barrier( MPI_COMM_GEOSX );
 
-  std::vector< char > buffer( rootPath.size() + 64 );
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer.data(), buffer.size(), "%s/rank_%07d.hdf5", rootPath.data(), MpiWrapper::Comm_rank() ), 1024 );
-  return buffer.data();
+  if( aggregated )
+  {
+    return formatRestartPath( "%s/file_%07d.hdf5", rootPath, fileIndexOfRank( rank, size, numFiles ) );
+  }
+  return formatRestartPath( "%s/rank_%07d.hdf5", rootPath, rank );
 }
 
 
-std::string readRootNode( std::string const & rootPath )
+/**
+ * @brief Read the root file of a restart and locate the tree of this rank.
+ * @param rootPath the restart root path
+ * @param filePath the file holding the tree of this rank
+ * @param treePath the path of the tree in the file, empty if the tree is the whole file
+ */
+void readRootNode( std::string const & rootPath, std::string & filePath, std::string & treePath )
 {
-  std::string rankFilePattern;
+  std::string filePattern;
+  std::string treePattern;
+  int numFiles = 0;
+  int numTrees = 0;
   if( MpiWrapper::Comm_rank() == 0 )
   {
     conduit::Node node;
     conduit::relay::io::load( rootPath + ".root", "hdf5", node );
 
-    int const nFiles = node.fetch_child( "number_of_files" ).value();
-    GEOSX_ERROR_IF_NE( nFiles, MpiWrapper::Comm_size() );
-
-    std::string const filePattern = node.fetch_child( "file_pattern" ).as_string();
+    numFiles = node.fetch_child( "number_of_files" ).value();
+    treePattern = node.fetch_child( "tree_pattern" ).as_string();
+    numTrees = ( treePattern == "/" ) ? numFiles : static_cast< int >( node.fetch_child( "number_of_trees" ).value() );
 
     std::string rootDirName, rootFileName;
     splitPath( rootPath, rootDirName, rootFileName );
 
-    rankFilePattern = rootDirName + "/" + filePattern;
-    GEOSX_LOG_RANK_VAR( rankFilePattern );
+    filePattern = rootDirName + "/" + node.fetch_child( "file_pattern" ).as_string();
+    GEOSX_LOG_RANK_VAR( filePattern );
   }
 
-  MpiWrapper::Broadcast( rankFilePattern, 0 );
+  MpiWrapper::Broadcast( filePattern, 0 );
+  MpiWrapper::Broadcast( treePattern, 0 );
+  MpiWrapper::Broadcast( numFiles, 0 );
+  MpiWrapper::Broadcast( numTrees, 0 );
+
+  int const rank = MpiWrapper::Comm_rank();
+  GEOSX_ERROR_IF_NE_MSG( numTrees, MpiWrapper::Comm_size(),
+                         "Restart " << rootPath << " was written by " << numTrees << " ranks, "
+                         "it can only be read back on the same number of ranks." );
 
   char buffer[ 1024 ];
-  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, rankFilePattern.data(), MpiWrapper::Comm_rank() ), 1024 );
-  return buffer;
+  GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, filePattern.data(), fileIndexOfRank( rank, numTrees, numFiles ) ), 1024 );
+  filePath = buffer;
+
+  treePath.clear();
+  if( treePattern != "/" )
+  {
+    GEOSX_ERROR_IF_GE( std::snprintf( buffer, 1024, treePattern.data(), rank ), 1024 );
+    treePath = buffer;
+  }
+}
+
+
+/**
+ * @brief Load the tree of this rank from a restart.
+ * @param rootPath the restart root path
+ * @param node the node to load the tree into
+ */
+void loadRankTree( std::string const & rootPath, conduit::Node & node )
+{
+  std::string filePath, treePath;
+  readRootNode( rootPath, filePath, treePath );
+  GEOSX_LOG_RANK( "Reading in restart file at " << filePath << ( treePath.empty() ? "" : ":" + treePath ) );
+  if( treePath.empty() )
+  {
+    conduit::relay::io::load( filePath, "hdf5", node );
+  }
+  else
+  {
+    conduit::relay::io::hdf5_read( filePath, treePath, node );
+  }
+}
+
+ConduitNodeDigest conduitNodeDigest( conduit::Node const & node )
+{
+  // The two hashes start from different seeds, both have to match for the data to be considered unchanged.
+  return { hashFinalize( hashNode( hashPrime5, node ) ),
+           hashFinalize( hashNode( hashPrime1 + hashPrime2, node ) ) };
+}
+
+
+void markUnchangedInRestart( conduit::Node & node )
+{
+  node[ unchangedKey ].set( integer( 1 ) );
 }
 
+
+void setRestartBase( std::string const & basePath )
+{
+  if( basePath.empty() )
+  {
+    if( rootConduitNode.has_child( restartBaseKey ) )
+    {
+      rootConduitNode.remove( restartBaseKey );
+    }
+    return;
+  }
+
+  std::string baseDirName, baseFileName;
+  splitPath( basePath, baseDirName, baseFileName );
+  rootConduitNode[ restartBaseKey ].set( baseFileName );
+}
+
+
 /* Write out a restart file. */
-void writeTree( std::string const & path )
+void writeTree( std::string const & path, int const numFiles )
 {
   GEOSX_MARK_FUNCTION;
 
+  waitForPendingWrite();
+
   conduit::Node root;
-  std::string const filePathForRank = writeRootFile( root, path );
-  GEOSX_LOG_RANK( "Writing out restart file at " << filePathForRank );
-  conduit::relay::io::save( rootConduitNode, filePathForRank, "hdf5" );
+  std::string const filePath = writeRootFile( root, path, numFiles );
+
+  if( !isAggregated( numFiles ) )
+  {
+    GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+    conduit::relay::io::save( rootConduitNode, filePath, "hdf5" );
+    return;
+  }
+
+  conduit::Node fileTree;
+  std::vector< conduit::Node > receivedTrees;
+  if( gatherFileTree( rootConduitNode, numFiles, fileTree, receivedTrees ) )
+  {
+    GEOSX_LOG_RANK( "Writing out restart file at " << filePath );
+    conduit::relay::io::save( fileTree, filePath, "hdf5" );
+  }
+}
+
+/* Write out a restart file on a background thread. */
+void writeTreeAsync( std::string const & path, int const numFiles )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // only one restart write in flight, and no HDF5 calls from two threads at once
+  waitForPendingWrite();
+
+  conduit::Node root;
+  std::string const filePath = writeRootFile( root, path, numFiles );
+
+  // Arrays are registered with conduit as external pointers into live simulation data,
+  // so take a contiguous copy that the caller is free to modify as soon as we return.
+  auto snapshot = std::make_shared< conduit::Node >();
+  if( !isAggregated( numFiles ) )
+  {
+    rootConduitNode.compact_to( *snapshot );
+  }
+  else
+  {
+    // the gather needs MPI, so it is done here rather than on the writing thread
+    conduit::Node fileTree;
+    std::vector< conduit::Node > receivedTrees;
+    if( !gatherFileTree( rootConduitNode, numFiles, fileTree, receivedTrees ) )
+    {
+      return;
+    }
+    fileTree.compact_to( *snapshot );
+  }
+
+  GEOSX_LOG_RANK( "Writing out restart file at " << filePath << " in the background" );
+  pendingWrite = std::async( std::launch::async, [snapshot, filePath]()
+  {
+    conduit::relay::io::save( *snapshot, filePath, "hdf5" );
+  } );
+}
+
+
+void waitForPendingWrite()
+{
+  if( pendingWrite.valid() )
+  {
+    GEOSX_MARK_SCOPE( waitForPendingRestartWrite );
+    pendingWrite.get();
+  }
+}
+
+
+void waitForPendingWriteBeforeHDF5()
+{
+#ifndef H5_HAVE_THREADSAFE
+  waitForPendingWrite();
+#endif
 }
 
 
 void loadTree( std::string const & path )
 {
   GEOSX_MARK_FUNCTION;
-  std::string const filePathForRank = readRootNode( path );
-  GEOSX_LOG_RANK( "Reading in restart file at " << filePathForRank );
-  conduit::relay::io::load( filePathForRank, "hdf5", rootConduitNode );
+  loadRankTree( path, rootConduitNode );
+
+  if( rootConduitNode.has_child( restartBaseKey ) )
+  {
+    // a delta restart: everything that did not change is in the base restart next to it
+    std::string rootDirName, rootFileName;
+    splitPath( path, rootDirName, rootFileName );
+    std::string const basePath = rootDirName + "/" + rootConduitNode.fetch_child( restartBaseKey ).as_string();
+
+    conduit::Node base;
+    loadRankTree( basePath, base );
+    fillUnchangedFromBase( rootConduitNode, &base );
+    rootConduitNode.remove( restartBaseKey );
+  }
 }
 
 } /* end namespace dataRepository */
@@ -27,6 +27,8 @@
 #include <conduit.hpp>
 
 // System includes
+#include <array>
+#include <cstdint>
 #include <string>
 
 /// @cond DO_NOT_DOCUMENT
@@ -88,9 +90,32 @@ using conduitTypeInfo = internal::conduitTypeInfo< std::remove_const_t< std::rem
 
 extern conduit::Node rootConduitNode;
 
-std::string writeRootFile( conduit::Node & root, std::string const & rootPath );
+// Writes the root file of a restart and returns the file this rank's tree goes to. With 0 < numFiles < number of
+// ranks, the trees of consecutive ranks are grouped into numFiles files, otherwise each rank has its own file.
+std::string writeRootFile( conduit::Node & root, std::string const & rootPath, int const numFiles = 0 );
 
-void writeTree( std::string const & path );
+// Digest of the data held by a node, made of two 64-bit hashes computed with different seeds.
+using ConduitNodeDigest = std::array< std::uint64_t, 2 >;
+
+// Computes a digest of the data held by a node and its descendants.
+ConduitNodeDigest conduitNodeDigest( conduit::Node const & node );
+
+// Marks a node of a delta restart whose content is to be taken from the base restart.
+void markUnchangedInRestart( conduit::Node & node );
+
+// Makes the restart tree a delta restart of the base restart at basePath (pass an empty path for a full restart).
+void setRestartBase( std::string const & basePath );
+
+void writeTree( std::string const & path, int const numFiles = 0 );
+
+// Copies rootConduitNode and writes the copy on a background thread; the tree may be reset on return.
+void writeTreeAsync( std::string const & path, int const numFiles = 0 );
+
+// Blocks until the background restart write, if any, has completed.
+void waitForPendingWrite();
+
+// Same as waitForPendingWrite(), unless HDF5 was built thread-safe.
+void waitForPendingWriteBeforeHDF5();
 
 void loadTree( std::string const & path );
 
@@ -474,23 +474,24 @@ localIndex Group::Unpack( buffer_unit_type const * & buffer,
 }
 
 
-void Group::prepareToWrite()
+void Group::prepareToWrite( RestartWriteMode const mode )
 {
   if( getRestartFlags() == RestartFlags::NO_WRITE )
   {
     return;
   }
 
-  forWrappers( [] ( WrapperBase & wrapper )
+  forWrappers( [mode] ( WrapperBase & wrapper )
   {
     wrapper.registerToWrite();
+    wrapper.applyRestartWriteMode( mode );
   } );
 
   m_conduitNode[ "__size__" ].set( m_size );
 
-  forSubGroups( []( Group & subGroup )
+  forSubGroups( [mode]( Group & subGroup )
   {
-    subGroup.prepareToWrite();
+    subGroup.prepareToWrite( mode );
   } );
 }
 
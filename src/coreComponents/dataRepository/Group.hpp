@@ -1400,8 +1400,9 @@ public:
 
   /**
    * @brief Register the group and its wrappers with Conduit.
+   * @param mode the kind of restart being written, see WrapperBase::applyRestartWriteMode()
    */
-  void prepareToWrite();
+  void prepareToWrite( RestartWriteMode const mode = RestartWriteMode::FULL );
 
   /**
    * @brief Write the group and its wrappers into Conduit.
@@ -36,6 +36,18 @@ enum class RestartFlags : integer
   WRITE_AND_READ ///< Write and read from restart
 };
 
+/**
+ * @enum RestartWriteMode
+ *
+ * A scoped enum for the kind of restart file being written.
+ */
+enum class RestartWriteMode : integer
+{
+  FULL,  ///< Write all the data
+  BASE,  ///< Write all the data and remember it as the base for later delta restarts
+  DELTA  ///< Write only the data that changed since the base restart
+};
+
 /**
  * @enum PlotLevel
  *
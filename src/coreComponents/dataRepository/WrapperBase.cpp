@@ -18,6 +18,7 @@
 
 #include "Group.hpp"
 #include "RestartFlags.hpp"
+#include "ConduitRestart.hpp"
 
 
 namespace geosx
@@ -36,7 +37,9 @@ WrapperBase::WrapperBase( std::string const & name,
   m_inputFlag( InputFlags::INVALID ),
   m_description(),
   m_registeringObjects(),
-  m_conduitNode( parent->getConduitNode()[ name ] )
+  m_conduitNode( parent->getConduitNode()[ name ] ),
+  m_restartBaseDigest{ 0, 0 },
+  m_hasRestartBaseDigest( false )
 {
   GEOSX_ERROR_IF( parent == nullptr, "Cannot have a view with no parent." );
 }
@@ -50,6 +53,26 @@ void WrapperBase::resize()
   resize( m_parent->size());
 }
 
+void WrapperBase::applyRestartWriteMode( RestartWriteMode const mode )
+{
+  if( mode == RestartWriteMode::FULL || getRestartFlags() == RestartFlags::NO_WRITE )
+  {
+    return;
+  }
+
+  ConduitNodeDigest const digest = conduitNodeDigest( m_conduitNode );
+  if( mode == RestartWriteMode::BASE )
+  {
+    m_restartBaseDigest = digest;
+    m_hasRestartBaseDigest = true;
+  }
+  else if( m_hasRestartBaseDigest && digest == m_restartBaseDigest )
+  {
+    m_conduitNode.reset();
+    markUnchangedInRestart( m_conduitNode );
+  }
+}
+
 void WrapperBase::copyWrapperAttributes( WrapperBase const & source )
 {
   GEOSX_ERROR_IF( source.m_name != this->m_name,
@@ -24,6 +24,7 @@
 #include "rajaInterface/GEOS_RAJA_Interface.hpp"
 #include "managers/TimeHistory/HistoryDataSpec.hpp"
 
+#include <array>
 #include <string>
 #include <memory>
 #include <set>
@@ -218,6 +219,16 @@ public:
    */
   virtual void finishWriting() const = 0;
 
+  /**
+   * @brief Apply a restart write mode to the data registered with Conduit by registerToWrite().
+   * @param mode the kind of restart being written
+   *
+   * For a base restart the digest of the registered data is recorded. For a delta restart, data whose
+   * digest matches the one recorded for the base restart is replaced by a marker that tells loadTree()
+   * to take it from the base restart.
+   */
+  void applyRestartWriteMode( RestartWriteMode const mode );
+
   /**
    * @brief Read the wrapped data from Conduit.
    * @return True iff the Wrapper read in data.
@@ -561,6 +572,12 @@ protected:
 
   /// A reference to the corresponding conduit::Node.
   conduit::Node & m_conduitNode;
+
+  /// Digest of the data written in the last base restart, see conduitNodeDigest()
+  std::array< std::uint64_t, 2 > m_restartBaseDigest;
+
+  /// Whether the data was written in the last base restart
+  bool m_hasRestartBaseDigest;
 };
 
 } /// namespace dataRepository
@@ -0,0 +1,117 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+// Source includes
+#include "common/DataTypes.hpp"
+#include "managers/initialization.hpp"
+#include "dataRepository/Group.hpp"
+#include "dataRepository/Wrapper.hpp"
+#include "dataRepository/ConduitRestart.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
+#include "utils.hpp"
+
+// TPL includes
+#include <gtest/gtest.h>
+
+// System includes
+#include <fstream>
+
+namespace geosx
+{
+namespace dataRepository
+{
+namespace testing
+{
+
+/**
+ * @brief Write the trees of all ranks to a single restart file, read them back and compare.
+ * @param fileName the restart root path
+ * @param asynchronous whether to write the restart on a background thread
+ */
+void testAggregatedRestart( std::string const & fileName, bool const asynchronous )
+{
+  int const rank = MpiWrapper::Comm_rank();
+  int const numFiles = 1;
+
+  // different sizes and values on each rank
+  localIndex const groupSize = 10 + 5 * rank;
+  Group * group = new Group( "root", nullptr );
+  group->resize( groupSize );
+
+  array1d< double > values( groupSize );
+  for( localIndex i = 0; i < groupSize; ++i )
+  {
+    values[ i ] = 1000.0 * rank + i;
+  }
+  group->registerWrapper< array1d< double > >( "values" )->setSizedFromParent( 1 )->reference() = values;
+
+  group->prepareToWrite();
+  if( asynchronous )
+  {
+    writeTreeAsync( fileName, numFiles );
+    group->finishWriting();
+    waitForPendingWrite();
+  }
+  else
+  {
+    writeTree( fileName, numFiles );
+    group->finishWriting();
+  }
+  MpiWrapper::Barrier();
+
+  // all trees are in the first (and only) file
+  EXPECT_TRUE( std::ifstream( fileName + "/file_0000000.hdf5" ).good() );
+  EXPECT_FALSE( std::ifstream( fileName + "/file_0000001.hdf5" ).good() );
+
+  delete group;
+  rootConduitNode.reset();
+
+  loadTree( fileName );
+  group = new Group( "root", nullptr );
+  Wrapper< array1d< double > > * const wrapper = group->registerWrapper< array1d< double > >( "values" );
+  group->loadFromConduit();
+
+  EXPECT_EQ( group->size(), groupSize );
+  compare( values, wrapper->reference() );
+
+  delete group;
+  rootConduitNode.reset();
+}
+
+TEST( AggregatedRestart, WriteAndRead )
+{
+  testAggregatedRestart( "testRestartAggregation_WriteAndRead", false );
+}
+
+TEST( AggregatedRestart, WriteAsyncAndRead )
+{
+  testAggregatedRestart( "testRestartAggregation_WriteAsyncAndRead", true );
+}
+
+} // namespace testing
+} // namespace dataRepository
+} // namespace geosx
+
+int main( int argc, char * argv[] )
+{
+  testing::InitGoogleTest( &argc, argv );
+
+  geosx::basicSetup( argc, argv );
+
+  int const result = RUN_ALL_TESTS();
+
+  geosx::basicCleanup();
+
+  return result;
+}
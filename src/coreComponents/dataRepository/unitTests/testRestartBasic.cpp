@@ -55,7 +55,7 @@ public:
     delete m_group;
   }
 
-  void test()
+  void test( bool const asynchronous = false )
   {
     T value;
     fill( value, 100 );
@@ -65,8 +65,20 @@ public:
 
     // Write out the tree
     m_group->prepareToWrite();
-    writeTree( m_fileName );
-    m_group->finishWriting();
+    if( asynchronous )
+    {
+      writeTreeAsync( m_fileName );
+
+      // The write works on a copy, so the data may change while it is in flight.
+      m_wrapper->reference() = T();
+      m_group->finishWriting();
+      waitForPendingWrite();
+    }
+    else
+    {
+      writeTree( m_fileName );
+      m_group->finishWriting();
+    }
 
     // Delete geosx tree and reset the conduit tree.
     delete m_group;
@@ -132,6 +144,111 @@ TYPED_TEST( SingleWrapperTest, WriteAndRead )
   this->test();
 }
 
+TYPED_TEST( SingleWrapperTest, WriteAsyncAndRead )
+{
+  this->test( true );
+}
+
+TEST( DeltaRestart, UnchangedDataComesFromBase )
+{
+  std::string const baseFileName = "testRestartBasic_DeltaRestartBase";
+  std::string const deltaFileName = "testRestartBasic_DeltaRestartDelta";
+
+  Group * group = new Group( "root", nullptr );
+  group->resize( 10 );
+
+  array1d< double > staticValues;
+  fill( staticValues, 100 );
+  array1d< double > changingValues;
+  fill( changingValues, 100 );
+
+  group->registerWrapper< array1d< double > >( "static" )->reference() = staticValues;
+  group->registerWrapper< array1d< double > >( "changing" )->reference() = changingValues;
+
+  // Write the base restart.
+  group->prepareToWrite( RestartWriteMode::BASE );
+  setRestartBase( "" );
+  writeTree( baseFileName );
+  group->finishWriting();
+
+  // Modify one wrapper and write a delta restart that only holds that one.
+  changingValues[ 0 ] += 1.0;
+  group->getReference< array1d< double > >( "changing" )[ 0 ] += 1.0;
+
+  group->prepareToWrite( RestartWriteMode::DELTA );
+  EXPECT_TRUE( group->getConduitNode()[ "static" ].has_child( "__unchangedSinceBase__" ) );
+  EXPECT_FALSE( group->getConduitNode()[ "changing" ].has_child( "__unchangedSinceBase__" ) );
+  setRestartBase( baseFileName );
+  writeTree( deltaFileName );
+  group->finishWriting();
+  setRestartBase( "" );
+
+  delete group;
+  rootConduitNode.reset();
+
+  // Load the delta restart, the static data is taken from the base.
+  loadTree( deltaFileName );
+  group = new Group( "root", nullptr );
+  Wrapper< array1d< double > > * const staticWrapper = group->registerWrapper< array1d< double > >( "static" );
+  Wrapper< array1d< double > > * const changingWrapper = group->registerWrapper< array1d< double > >( "changing" );
+  group->loadFromConduit();
+
+  EXPECT_EQ( group->size(), 10 );
+  compare( staticValues, staticWrapper->reference() );
+  compare( changingValues, changingWrapper->reference() );
+
+  delete group;
+  rootConduitNode.reset();
+}
+
+TEST( DeltaRestart, SignFlipsAreDetected )
+{
+  std::string const baseFileName = "testRestartBasic_SignFlipsBase";
+  std::string const deltaFileName = "testRestartBasic_SignFlipsDelta";
+
+  Group * group = new Group( "root", nullptr );
+  group->resize( 10 );
+
+  array1d< double > values( 10 );
+  for( localIndex i = 0; i < values.size(); ++i )
+  {
+    values[ i ] = 1.5 * i + 1.0;
+  }
+  group->registerWrapper< array1d< double > >( "values" )->reference() = values;
+
+  group->prepareToWrite( RestartWriteMode::BASE );
+  ConduitNodeDigest const baseDigest = conduitNodeDigest( group->getConduitNode()[ "values" ] );
+  setRestartBase( "" );
+  writeTree( baseFileName );
+  group->finishWriting();
+
+  // Flipping the sign bit of an even number of entries must change the digest.
+  values[ 2 ] = -values[ 2 ];
+  values[ 7 ] = -values[ 7 ];
+  group->getReference< array1d< double > >( "values" ) = values;
+
+  group->prepareToWrite( RestartWriteMode::DELTA );
+  EXPECT_NE( conduitNodeDigest( group->getConduitNode()[ "values" ] ), baseDigest );
+  EXPECT_FALSE( group->getConduitNode()[ "values" ].has_child( "__unchangedSinceBase__" ) );
+  setRestartBase( baseFileName );
+  writeTree( deltaFileName );
+  group->finishWriting();
+  setRestartBase( "" );
+
+  delete group;
+  rootConduitNode.reset();
+
+  loadTree( deltaFileName );
+  group = new Group( "root", nullptr );
+  Wrapper< array1d< double > > * const wrapper = group->registerWrapper< array1d< double > >( "values" );
+  group->loadFromConduit();
+
+  compare( values, wrapper->reference() );
+
+  delete group;
+  rootConduitNode.reset();
+}
+
 } // namespace testing
 } // namespace dataRepository
 } // namespace geosx
@@ -6,6 +6,8 @@
 
 #include <hdf5.h>
 
+#include <algorithm>
+
 namespace geosx
 {
 
@@ -96,6 +98,11 @@ HDFFile::HDFFile( string const & fnm, bool deleteExisting, bool parallelAccess,
   {
     m_faplId = H5Pcreate( H5P_FILE_ACCESS );
     H5Pset_fapl_mpio( m_faplId, m_comm, MPI_INFO_NULL );
+#if H5_VERSION_GE( 1, 10, 0 )
+    // every rank opens the file, so let a single rank read/write the metadata and broadcast it
+    H5Pset_all_coll_metadata_ops( m_faplId, true );
+    H5Pset_coll_metadata_write( m_faplId, true );
+#endif
     m_filename = fnm + ".hdf5";
   }
   else
@@ -216,8 +223,9 @@ void HDFHistIO::init( bool exists_okay )
     std::vector< hsize_t > historyFileDims( m_rank+1 );
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
+    // chunk over as many records as the preallocation so each write touches few chunks
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+    dimChunks[0] = std::max( historyFileDims[0], hsize_t( 1 ) );
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -264,10 +272,10 @@ void HDFHistIO::write( )
     MpiWrapper::allReduce( &m_bufferedCount, &maxBuffered, 1, MPI_MAX, m_subcomm );
     if( maxBuffered > 0 )
     {
-      resizeFileIfNeeded( maxBuffered );
       HDFFile target( m_filename, false, true, m_subcomm );
 
       hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+      resizeFileIfNeeded( dataset, maxBuffered );
       hid_t filespace = H5Dget_space( dataset );
 
       std::vector< hsize_t > fileOffset( m_rank+1 );
@@ -291,8 +299,19 @@ void HDFHistIO::write( )
       {
         dataBuffer = &m_dataBuffer[0];
       }
-      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, H5P_DEFAULT, dataBuffer );
+      hid_t dxplId = H5P_DEFAULT;
+#ifdef GEOSX_USE_MPI
+      // every rank in the subcomm takes part in the write, so let MPI-IO aggregate it; the slabs
+      // differ in size between ranks (each writes its own local entries at its own offset, possibly none)
+      dxplId = H5Pcreate( H5P_DATASET_XFER );
+      H5Pset_dxpl_mpio( dxplId, H5FD_MPIO_COLLECTIVE );
+#endif
+      H5Dwrite( dataset, m_hdfType, memspace, fileHyperslab, dxplId, dataBuffer );
 
+      if( dxplId != H5P_DEFAULT )
+      {
+        H5Pclose( dxplId );
+      }
       H5Sclose( memspace );
       H5Sclose( filespace );
       H5Dclose( dataset );
@@ -322,11 +341,10 @@ void HDFHistIO::compressInFile( )
   }
 }
 
-inline void HDFHistIO::resizeFileIfNeeded( localIndex buffered_count )
+inline void HDFHistIO::resizeFileIfNeeded( hid_t dataset, localIndex buffered_count )
 {
   if( m_subcomm != MPI_COMM_NULL )
   {
-    HDFFile target( m_filename, false, true, m_subcomm );
     if( m_writeHead + buffered_count > m_writeLimit )
     {
       while( m_writeHead + buffered_count > m_writeLimit )
@@ -340,9 +358,7 @@ inline void HDFHistIO::resizeFileIfNeeded( localIndex buffered_count )
       {
         maxFileDims[dd] = m_dims[dd-1];
       }
-      hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
       H5Dset_extent( dataset, &maxFileDims[0] );
-      H5Dclose( dataset );
     }
   }
 }
@@ -399,8 +415,9 @@ void HDFSerialHistIO::init( bool exists_okay )
     std::vector< hsize_t > historyFileDims( m_rank+1 );
     historyFileDims[0] = LvArray::integerConversion< hsize_t >( m_writeLimit );
 
+    // chunk over as many records as the preallocation so each write touches few chunks
     std::vector< hsize_t > dimChunks( m_rank+1 );
-    dimChunks[0] = 1;
+    dimChunks[0] = std::max( historyFileDims[0], hsize_t( 1 ) );
 
     for( hsize_t dd = 1; dd < m_rank+1; ++dd )
     {
@@ -441,10 +458,10 @@ void HDFSerialHistIO::write( )
   // don't need to write if nothing is buffered, this should only happen if the output event occurs before the collection event
   if( m_typeCount > 0 && m_bufferedCount > 0 )
   {
-    resizeFileIfNeeded( m_bufferedCount );
     HDFFile target( m_filename, false, false, m_comm );
 
     hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
+    resizeFileIfNeeded( dataset, m_bufferedCount );
     hid_t filespace = H5Dget_space( dataset );
 
     std::vector< hsize_t > fileOffset( m_rank+1 );
@@ -498,11 +515,10 @@ void HDFSerialHistIO::compressInFile( )
   }
 }
 
-inline void HDFSerialHistIO::resizeFileIfNeeded( localIndex buffered_count )
+inline void HDFSerialHistIO::resizeFileIfNeeded( hid_t dataset, localIndex buffered_count )
 {
   if( m_typeCount > 0 )
   {
-    HDFFile target( m_filename, false, false, m_comm );
     if( m_writeHead + buffered_count > m_writeLimit )
     {
       while( m_writeHead + buffered_count > m_writeLimit )
@@ -516,9 +532,7 @@ inline void HDFSerialHistIO::resizeFileIfNeeded( localIndex buffered_count )
       {
         maxFileDims[dd] = m_dims[dd-1];
       }
-      hid_t dataset = H5Dopen( target, m_name.c_str(), H5P_DEFAULT );
       H5Dset_extent( dataset, &maxFileDims[0] );
-      H5Dclose( dataset );
     }
   }
 }
@@ -169,9 +169,10 @@ public:
 
   /**
    * @brief Resize the dataspace in the target file if needed to perform the current write of buffered states.
+   * @param dataset The open dataset to resize.
    * @param bufferedCount The number of buffered states to use to determine if the file needs to be resized.
    */
-  inline void resizeFileIfNeeded( localIndex bufferedCount );
+  inline void resizeFileIfNeeded( hid_t dataset, localIndex bufferedCount );
 
 protected:
   virtual void resizeBuffer( ) override;
@@ -280,9 +281,10 @@ public:
 
   /**
    * @brief Resize the dataspace in the target file if needed to perform the current write of buffered states.
+   * @param dataset The open dataset to resize.
    * @param bufferedCount The number of buffered states to use to determine if the file needs to be resized.
    */
-  inline void resizeFileIfNeeded( localIndex bufferedCount );
+  inline void resizeFileIfNeeded( hid_t dataset, localIndex bufferedCount );
 
 protected:
   virtual void resizeBuffer( ) override;
@@ -15,6 +15,7 @@
 // Source includes
 #include "VTKPolyDataWriterInterface.hpp"
 #include "dataRepository/Group.hpp"
+#include "common/TimingMacros.hpp"
 
 // TPL includes
 #include <vtkUnstructuredGrid.h>
@@ -23,6 +24,7 @@
 #include <vtkExtentTranslator.h>
 
 // System includes
+#include <memory>
 #include <unordered_set>
 #include <sys/stat.h>
 
@@ -73,10 +75,59 @@ int ToVTKCellType( const string & elementType )
   return vtkIdentifier;
 }
 
+/*!
+ * @brief Writes an unstructured grid in a vtu file
+ * @param[in] ug the VTK unstructured grid
+ * @param[in] vtuFilePath the path of the vtu file
+ * @param[in] outputMode the output mode, ASCII or BINARY
+ * @param[in] compressor the compression of the binary data
+ */
+void WriteVTUFile( vtkUnstructuredGrid * const ug,
+                   string const & vtuFilePath,
+                   VTKOutputMode const outputMode,
+                   VTKCompressor const compressor )
+{
+  vtkSmartPointer< vtkXMLUnstructuredGridWriter > vtuWriter = vtkXMLUnstructuredGridWriter::New();
+  vtuWriter->SetInputData( ug );
+  vtuWriter->SetFileName( vtuFilePath.c_str() );
+  if( outputMode == VTKOutputMode::BINARY )
+  {
+    // Raw appended data avoids the base64 encoding of the inline binary mode
+    vtuWriter->SetDataModeToAppended();
+    vtuWriter->EncodeAppendedDataOff();
+    switch( compressor )
+    {
+      case VTKCompressor::ZLIB:
+      {
+        vtuWriter->SetCompressorTypeToZLib();
+        break;
+      }
+      case VTKCompressor::LZ4:
+      {
+        vtuWriter->SetCompressorTypeToLZ4();
+        break;
+      }
+      default:
+      {
+        vtuWriter->SetCompressorTypeToNone();
+      }
+    }
+  }
+  else if( outputMode == VTKOutputMode::ASCII )
+  {
+    vtuWriter->SetDataModeToAscii();
+  }
+  vtuWriter->Write();
+}
+
 VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string const & outputName ):
   m_outputFolder( outputName ),
   m_pvd( outputName + ".pvd" ),
-  m_previousCycle( -1 )
+  m_previousCycle( -1 ),
+  m_outputMode( VTKOutputMode::BINARY ),
+  m_compressor( VTKCompressor::NONE ),
+  m_asynchronous( false ),
+  m_numPoints( -1 )
 {
   int const mpiRank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
   if( mpiRank == 0 )
@@ -98,6 +149,11 @@ VTKPolyDataWriterInterface::VTKPolyDataWriterInterface( string const & outputNam
   MpiWrapper::Barrier();
 }
 
+VTKPolyDataWriterInterface::~VTKPolyDataWriterInterface()
+{
+  WaitForPendingWrite();
+}
+
 vtkSmartPointer< vtkPoints >  VTKPolyDataWriterInterface::GetVTKPoints( NodeManager const & nodeManager ) const
 {
   vtkSmartPointer< vtkPoints > points = vtkPoints::New();
@@ -271,8 +327,9 @@ void VTKPolyDataWriterInterface::WriteField( WrapperBase const & wrapperBase, vt
 
 }
 
-void VTKPolyDataWriterInterface::WriteNodeFields( vtkSmartPointer< vtkPointData > const pointdata, NodeManager const & nodeManager ) const
+std::vector< vtkSmartPointer< VTKGEOSXData > > VTKPolyDataWriterInterface::GetNodeFields( NodeManager const & nodeManager ) const
 {
+  std::vector< vtkSmartPointer< VTKGEOSXData > > nodeFields;
   for( auto const & wrapperIter : nodeManager.wrappers() )
   {
     auto const & wrapper = *wrapperIter.second;
@@ -283,9 +340,10 @@ void VTKPolyDataWriterInterface::WriteNodeFields( vtkSmartPointer< vtkPointData
       data->SetName( wrapper.getName().c_str() );;
       localIndex count = 0;
       WriteField( wrapper, data, nodeManager.size(), count );
-      pointdata->AddArray( data );
+      nodeFields.push_back( data );
     }
   }
+  return nodeFields;
 }
 
 template< class SUBREGION >
@@ -319,22 +377,43 @@ void VTKPolyDataWriterInterface::WriteElementFields( vtkSmartPointer< vtkCellDat
     celldata->AddArray( data );
   }
 }
-void VTKPolyDataWriterInterface::WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const
+void VTKPolyDataWriterInterface::WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager )
 {
+  // The reference positions do not move, the points only change when nodes are added.
+  if( m_numPoints != nodeManager.size() )
+  {
+    m_points = GetVTKPoints( nodeManager );
+    m_numPoints = nodeManager.size();
+    m_cellRegionGeometry.clear();
+  }
+
+  // The node fields are the same for all the regions, the grids share the arrays
+  std::vector< vtkSmartPointer< VTKGEOSXData > > const nodeFields = GetNodeFields( nodeManager );
+
   elemManager.forElementRegions< CellElementRegion >( [&]( CellElementRegion const & er )->void
   {
     vtkSmartPointer< vtkUnstructuredGrid > ug = vtkUnstructuredGrid::New();
-    auto VTKPoints = GetVTKPoints( nodeManager );
-    ug->SetPoints( VTKPoints );
-    auto VTKCells = GetVTKCells( er );
-    ug->SetCells( VTKCells.first.data(), VTKCells.second );
+    ug->SetPoints( m_points );
+    CellRegionGeometry & geometry = m_cellRegionGeometry[ er.getName() ];
+    localIndex const numElems = er.getNumberOfElements< CellElementRegion >();
+    if( geometry.numElems != numElems )
+    {
+      auto VTKCells = GetVTKCells( er );
+      geometry.cellTypes = std::move( VTKCells.first );
+      geometry.cells = VTKCells.second;
+      geometry.numElems = numElems;
+    }
+    ug->SetCells( geometry.cellTypes.data(), geometry.cells );
     WriteElementFields< CellElementSubRegion >( ug->GetCellData(), er );
-    WriteNodeFields( ug->GetPointData(), nodeManager );
+    for( vtkSmartPointer< VTKGEOSXData > const & data : nodeFields )
+    {
+      ug->GetPointData()->AddArray( data );
+    }
     WriteUnstructuredGrid( ug, time, er.getName() );
   } );
 }
 
-void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const
+void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< WellElementRegion >( [&]( WellElementRegion const & er )->void
   {
@@ -348,7 +427,7 @@ void VTKPolyDataWriterInterface::WriteWellElementRegions( real64 time, ElementRe
   } );
 }
 
-void VTKPolyDataWriterInterface::WriteFaceElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const
+void VTKPolyDataWriterInterface::WriteFaceElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager )
 {
   elemManager.forElementRegions< FaceElementRegion >( [&]( FaceElementRegion const & er )->void
   {
@@ -377,7 +456,7 @@ void VTKPolyDataWriterInterface::WriteFaceElementRegions( real64 time, ElementRe
 void VTKPolyDataWriterInterface::WriteEmbeddedSurfaceElementRegions( real64 time,
                                                                      ElementRegionManager const & elemManager,
                                                                      NodeManager const & nodeManager,
-                                                                     EdgeManager const & edgeManager ) const
+                                                                     EdgeManager const & edgeManager )
 {
   elemManager.forElementRegions< EmbeddedSurfaceRegion >( [&]( EmbeddedSurfaceRegion const & er )->void
   {
@@ -450,23 +529,51 @@ void VTKPolyDataWriterInterface::CreateTimeStepSubFolder( real64 time ) const
   MpiWrapper::Barrier();
 }
 
-void VTKPolyDataWriterInterface::WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name ) const
+void VTKPolyDataWriterInterface::WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name )
 {
   string timeStepSubFolder = VTKPolyDataWriterInterface::GetTimeStepSubFolder( time );
-  vtkSmartPointer< vtkXMLUnstructuredGridWriter > vtuWriter =vtkXMLUnstructuredGridWriter::New();
-  vtuWriter->SetInputData( ug );
   string vtuFilePath = timeStepSubFolder + "/" +
                        stringutilities::PadValue( MpiWrapper::Comm_rank(), std::to_string( MpiWrapper::Comm_size() ).size() ) +"_" + name + ".vtu";
-  vtuWriter->SetFileName( vtuFilePath.c_str() );
-  if( m_outputMode == VTKOutputMode::BINARY )
+  m_gridsToWrite.emplace_back( ug, vtuFilePath );
+}
+
+void VTKPolyDataWriterInterface::WriteUnstructuredGrids()
+{
+  // The grids own copies of the fields, and the cached points and cells they share
+  // are replaced rather than modified, so they can be written while the simulation goes on.
+  auto grids = std::make_shared< std::vector< std::pair< vtkSmartPointer< vtkUnstructuredGrid >, string > > >();
+  grids->swap( m_gridsToWrite );
+  VTKOutputMode const outputMode = m_outputMode;
+  VTKCompressor const compressor = m_compressor;
+
+  auto writeGrids = [grids, outputMode, compressor]()
   {
-    vtuWriter->SetDataModeToBinary();
+    // Written one after the other: the grids share the points and node field arrays, and the
+    // VTK writers cache array ranges in those arrays, which is not thread-safe. This also keeps
+    // the background thread from spawning a thread team next to the solver's.
+    for( std::pair< vtkSmartPointer< vtkUnstructuredGrid >, string > const & grid : *grids )
+    {
+      WriteVTUFile( grid.first, grid.second, outputMode, compressor );
+    }
+  };
+
+  if( m_asynchronous )
+  {
+    m_pendingWrite = std::async( std::launch::async, writeGrids );
   }
-  else if( m_outputMode == VTKOutputMode::ASCII )
+  else
   {
-    vtuWriter->SetDataModeToAscii();
+    writeGrids();
+  }
+}
+
+void VTKPolyDataWriterInterface::WaitForPendingWrite()
+{
+  if( m_pendingWrite.valid() )
+  {
+    GEOSX_MARK_SCOPE( waitForPendingVTKWrite );
+    m_pendingWrite.get();
   }
-  vtuWriter->Write();
 }
 
 string VTKPolyDataWriterInterface::GetTimeStepSubFolder( real64 time ) const
@@ -476,6 +583,11 @@ string VTKPolyDataWriterInterface::GetTimeStepSubFolder( real64 time ) const
 
 void VTKPolyDataWriterInterface::Write( real64 time, integer cycle, DomainPartition const & domain )
 {
+  GEOSX_MARK_FUNCTION;
+
+  // only one time step written in the background at a time
+  WaitForPendingWrite();
+
   CreateTimeStepSubFolder( time );
   ElementRegionManager const & elemManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getElemManager();
   NodeManager const & nodeManager = *domain.getMeshBody( 0 )->getMeshLevel( 0 )->getNodeManager();
@@ -484,6 +596,7 @@ void VTKPolyDataWriterInterface::Write( real64 time, integer cycle, DomainPartit
   WriteWellElementRegions( time, elemManager, nodeManager );
   WriteFaceElementRegions( time, elemManager, nodeManager );
   WriteEmbeddedSurfaceElementRegions( time, elemManager, nodeManager, edgeManager );
+  WriteUnstructuredGrids();
   string vtmPath = GetTimeStepSubFolder( time ) + ".vtm";
   VTKVTMWriter vtmWriter( vtmPath );
   WriteVTMFile( time, elemManager, vtmWriter );
@@ -16,6 +16,7 @@
 #define GEOSX_FILEIO_VTK_VTKMULTIBLOCKWRITERINTERFACE_HPP_
 
 #include "common/DataTypes.hpp"
+#include "common/EnumStrings.hpp"
 
 #include "managers/DomainPartition.hpp"
 
@@ -33,6 +34,8 @@
 #include <vtkSmartPointer.h>
 #include <vtkPoints.h>
 
+#include <future>
+
 namespace geosx
 {
 using namespace dataRepository;
@@ -45,6 +48,17 @@ enum struct VTKOutputMode
   ASCII
 };
 
+/// Compression of the binary data of the vtu files
+enum struct VTKCompressor
+{
+  NONE,
+  ZLIB,
+  LZ4
+};
+
+/// Strings for VTKCompressor
+ENUM_STRINGS( VTKCompressor, "none", "zlib", "lz4" )
+
 /*!
  * @brief Encapsulate output methods for vtk
  */
@@ -57,6 +71,11 @@ public:
    */
   VTKPolyDataWriterInterface( string const & outputName );
 
+  /*!
+   * @brief Destructor, waits for the files still being written in the background
+   */
+  ~VTKPolyDataWriterInterface();
+
   /*!
    * @brief Sets the plot level
    * @details All fields have an associated plot level. If it is <= to \p plotLevel,
@@ -77,6 +96,32 @@ public:
     m_outputMode = mode;
   }
 
+  /*!
+   * @brief Set the compression of the binary data
+   * @param[in] compressor the compressor to be used, ignored in ASCII mode
+   */
+  void SetCompressor( VTKCompressor compressor )
+  {
+    m_compressor = compressor;
+  }
+
+  /*!
+   * @brief Set whether the vtu files are written on a background thread
+   * @details The data of the domain is copied into the VTK objects before the
+   * method Write returns, so the simulation can go on while the files are written.
+   * Only one time step is written at a time.
+   * @param[in] asynchronous true to write the vtu files in the background
+   */
+  void SetAsynchronous( bool asynchronous )
+  {
+    m_asynchronous = asynchronous;
+  }
+
+  /*!
+   * @brief Wait for the vtu files being written in the background, if any
+   */
+  void WaitForPendingWrite();
+
   /*!
    * @brief Main method of this class. Write all the files for one time step.
    * @details This method writes a .pvd file (if a previous one was created from a precedent time step,
@@ -106,6 +151,8 @@ public:
    *      - rank1
    *      - rank2
    *      - ...
+   * The vtu files of the different regions are compressed and written one after the other,
+   * on a background thread when the writer is asynchronous.
    * @param[in] time the time step to be written
    * @param[in] cycle the current cycle of event
    * @param[in] domain the computation domain of this rank
@@ -134,11 +181,15 @@ private:
   /*!
    * @brief Writes the files for all the CellElementRegions.
    * @details There will be one file written per CellElementRegion and per rank.
+   * The vertices and the cell connectivities are only rebuilt when the number of nodes
+   * or of elements of the region changed since the previous output (e.g. after a split
+   * of the mesh by the SurfaceGenerator), otherwise the cached ones are reused.
+   * The node fields are copied once and shared by the grids of all the regions.
    * @param[in] time the time-step
    * @param[in] elemManager the ElementRegionManager containing the CellElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteCellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities as
@@ -164,7 +215,7 @@ private:
    * @param[in] elemManager the ElementRegionManager containing the WellElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteWellElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities and the vertices coordinates
@@ -183,7 +234,7 @@ private:
    * @param[in] elemManager the ElementRegionManager containing the FaceElementRegions to be output
    * @param[in] nodeManager the NodeManager containing the nodes of the domain to be output
    */
-  void WriteFaceElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager ) const;
+  void WriteFaceElementRegions( real64 time, ElementRegionManager const & elemManager, NodeManager const & nodeManager );
 
   /*!
    * @brief Gets the cell connectivities and the vertices coordinates
@@ -222,7 +273,7 @@ private:
   void WriteEmbeddedSurfaceElementRegions( real64 time,
                                            ElementRegionManager const & elemManager,
                                            NodeManager const & nodeManager,
-                                           EdgeManager const & edgeManager ) const;
+                                           EdgeManager const & edgeManager );
 
   /*!
    * @brief Writes a VTM file for the time-step \p time.
@@ -234,11 +285,11 @@ private:
   void WriteVTMFile( real64 time, ElementRegionManager const & elemManager, VTKVTMWriter const & vtmWriter ) const;
 
   /*!
-   * @brief Write all the fields associated to the nodes of \p nodeManager if their plotlevel is <= m_plotLevel
-   * @param[in] pointdata a VTK object containing all the fields associated with the nodes
+   * @brief Copy all the fields associated to the nodes of \p nodeManager if their plotlevel is <= m_plotLevel
    * @param[in] nodeManager the NodeManager associated with the domain being written
+   * @return the VTK arrays of the node fields, to be added to the point data of the grids
    */
-  void WriteNodeFields( vtkSmartPointer< vtkPointData > const pointdata, NodeManager const & nodeManager ) const;
+  std::vector< vtkSmartPointer< VTKGEOSXData > > GetNodeFields( NodeManager const & nodeManager ) const;
 
   /*!
    * @brief Writes all the fields associated to the elements of \p er if their plotlevel is <= m_plotLevel
@@ -261,18 +312,38 @@ private:
   void WriteField( WrapperBase const & wrapperBase, vtkSmartPointer< VTKGEOSXData > data, localIndex size, localIndex & count ) const;
 
   /*!
-   * @brief Writes an unstructured grid
+   * @brief Queues an unstructured grid to be written
    * @details The unstructured grid is the last element in the hiearchy of the output,
    * it contains the cells connectivities and the vertices coordinates as long as the
-   * data fields associated with it
+   * data fields associated with it. The queued grids are written by WriteUnstructuredGrids.
    * @param[in] ug a VTK SmartPointer to the VTK unstructured grid.
    * @param[in] time the current time-step
    * @param[in] name the name of the ElementRegionBase to be written
    */
-  void WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name ) const;
+  void WriteUnstructuredGrid( vtkSmartPointer< vtkUnstructuredGrid > ug, double time, string const & name );
+
+  /*!
+   * @brief Writes the queued unstructured grids, one vtu file after the other
+   * @details The grids share the points and node field arrays, so they are not written in parallel.
+   *          They are written on a background thread if the writer is asynchronous.
+   */
+  void WriteUnstructuredGrids();
 
 private:
 
+  /*!
+   * @brief Cell connectivities of a CellElementRegion kept from one output to the next.
+   */
+  struct CellRegionGeometry
+  {
+    /// Number of elements of the region when the connectivities were built
+    localIndex numElems = -1;
+    /// VTK type of each cell
+    std::vector< int > cellTypes;
+    /// Cell connectivities
+    vtkSmartPointer< vtkCellArray > cells;
+  };
+
   /// Folder name in which all the files will be written
   string const m_outputFolder;
 
@@ -288,6 +359,27 @@ private:
 
   /// Output mode, could be ASCII or BINARAY
   VTKOutputMode m_outputMode;
+
+  /// Compression of the binary data
+  VTKCompressor m_compressor;
+
+  /// Whether the vtu files are written on a background thread
+  bool m_asynchronous;
+
+  /// Grids of the current time step waiting to be written, with the path of their vtu file
+  std::vector< std::pair< vtkSmartPointer< vtkUnstructuredGrid >, string > > m_gridsToWrite;
+
+  /// The vtu files being written on a background thread, if any
+  std::future< void > m_pendingWrite;
+
+  /// Vertices of the domain, shared by the CellElementRegions
+  vtkSmartPointer< vtkPoints > m_points;
+
+  /// Number of nodes when m_points was built
+  localIndex m_numPoints;
+
+  /// Cell connectivities of the CellElementRegions, by region name
+  std::map< string, CellRegionGeometry > m_cellRegionGeometry;
 };
 
 } // namespace vtk
@@ -119,7 +119,9 @@ FiniteElementDiscretization::
 
   constexpr localIndex numNodesPerElem = FE_TYPE::numNodes;
   constexpr localIndex numQuadraturePointsPerElem = FE_TYPE::numQuadraturePoints;
-  dNdX.resizeWithoutInitializationOrDestruction( elementSubRegion->size(), numQuadraturePointsPerElem, numNodesPerElem, 3 );
+  // When the kernels compute the derivatives themselves only detJ is kept.
+  localIndex const numStoredElems = FE_TYPE::storesShapeFunctionDerivatives ? elementSubRegion->size() : 0;
+  dNdX.resizeWithoutInitializationOrDestruction( numStoredElems, numQuadraturePointsPerElem, numNodesPerElem, 3 );
   detJ.resize( elementSubRegion->size(), numQuadraturePointsPerElem );
 
   for( localIndex k = 0; k < elementSubRegion->size(); ++k )
@@ -141,6 +143,11 @@ FiniteElementDiscretization::
       real64 dNdXLocal[numNodesPerElem][3];
       detJ( k, q ) = finiteElement.shapeFunctionDerivatives( q, xLocal, dNdXLocal );
 
+      if( !FE_TYPE::storesShapeFunctionDerivatives )
+      {
+        continue;
+      }
+
       for( localIndex b = 0; b < numNodesPerElem; ++b )
       {
         LvArray::tensorOps::copy< 3 >( dNdX[ k ][ q ][ b ], dNdXLocal[b] );
@@ -78,6 +78,59 @@ public:
            J[2][0] * ( J[0][1]*J[1][2] - J[0][2]*J[1][1] );
   }
 
+#if defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
+  /// Whether the shape function derivatives at the quadrature points are
+  /// precomputed and stored for each element.
+  static constexpr bool storesShapeFunctionDerivatives = false;
+#else
+  /// Whether the shape function derivatives at the quadrature points are
+  /// precomputed and stored for each element.
+  static constexpr bool storesShapeFunctionDerivatives = true;
+#endif
+
+  /**
+   * @brief Get the shape function derivatives at a quadrature point of an
+   *        element, in the way selected at build time.
+   * @tparam FE_TYPE The finite element type.
+   * @tparam STORED Whether to read the stored derivatives or compute them,
+   *                defaults to the build time choice.
+   * @param k The element index.
+   * @param q The quadrature point index.
+   * @param xLocal The element nodal coordinates, only read when the
+   *               derivatives are not stored.
+   * @param storedDNdX The precomputed derivatives, only read when they are
+   *                   stored.
+   * @param dNdX The shape function derivatives at quadrature point @p q.
+   *
+   * With GEOSX_USE_FE_GRADIENTS_ON_THE_FLY, the derivatives are computed from
+   * @p xLocal, which costs flops but no memory traffic. Otherwise they are
+   * copied from @p storedDNdX.
+   */
+  template< typename FE_TYPE, bool STORED = storesShapeFunctionDerivatives >
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static void getShapeFunctionDerivatives( localIndex const k,
+                                           localIndex const q,
+                                           real64 const (&xLocal)[FE_TYPE::numNodes][3],
+                                           arrayView4d< real64 const > const & storedDNdX,
+                                           real64 (& dNdX)[FE_TYPE::numNodes][3] )
+  {
+    if( STORED )
+    {
+      for( localIndex a = 0; a < FE_TYPE::numNodes; ++a )
+      {
+        for( int i = 0; i < 3; ++i )
+        {
+          dNdX[ a ][ i ] = storedDNdX( k, q, a, i );
+        }
+      }
+    }
+    else
+    {
+      FE_TYPE::shapeFunctionDerivatives( q, xLocal, dNdX );
+    }
+  }
+
 
 //TODO we want to keep views and provide interfaces to this data here for cases
 //     where we pre-compute the shape function derivatives...maybe...tbd.
@@ -153,6 +153,46 @@ integralTypeDispatch( INTEGRAL_TYPE const input,
   }
 }
 
+/**
+ * @struct ElementBatchPolicy
+ * @brief Launch policy for KernelBase::kernelLaunch() that processes the
+ *        elements in batches of @p BATCH_SIZE per iteration.
+ * @tparam POLICY The host RAJA policy used to launch the batches.
+ * @tparam BATCH_SIZE The number of elements per batch, typically a multiple
+ *                    of the SIMD width.
+ *
+ * Within a batch, each kernel phase is applied to all the elements of the
+ * batch before moving on to the next phase, with the loop over the elements
+ * innermost. This lets the compiler vectorize the quadrature point work
+ * across elements.
+ */
+template< typename POLICY, int BATCH_SIZE >
+struct ElementBatchPolicy
+{
+  static_assert( std::is_same< POLICY, serialPolicy >::value ||
+                 std::is_same< POLICY, parallelHostPolicy >::value,
+                 "Element batches are only available for host policies." );
+
+  /// The RAJA policy used to launch the batches.
+  using launchPolicy = POLICY;
+
+  /// The number of elements per batch.
+  static constexpr int batchSize = BATCH_SIZE;
+};
+
+/**
+ * @brief Trait to detect an ElementBatchPolicy.
+ * @tparam POLICY The launch policy.
+ */
+template< typename POLICY >
+struct isElementBatchPolicy : std::false_type
+{};
+
+/// @copydoc isElementBatchPolicy
+template< typename POLICY, int BATCH_SIZE >
+struct isElementBatchPolicy< ElementBatchPolicy< POLICY, BATCH_SIZE > > : std::true_type
+{};
+
 //*****************************************************************************
 //*****************************************************************************
 //*****************************************************************************
@@ -432,7 +472,8 @@ public:
             typename KERNEL_TYPE >
   static
   typename std::enable_if< !( std::is_same< POLICY, serialPolicy >::value ||
-                              std::is_same< POLICY, parallelHostPolicy >::value ), real64 >::type
+                              std::is_same< POLICY, parallelHostPolicy >::value ||
+                              isElementBatchPolicy< POLICY >::value ), real64 >::type
   kernelLaunch( localIndex const numElems,
                 KERNEL_TYPE const & kernelComponent )
   {
@@ -465,6 +506,114 @@ public:
   }
   //END_kernelLauncher
 
+  /**
+   * @brief Kernel Launcher processing the elements in batches.
+   * @tparam POLICY The ElementBatchPolicy to use for the launch.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @param numElems The number of elements to process in this launch.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @return The maximum residual contribution.
+   *
+   * Same as the other launchers, except that each iteration processes
+   * ElementBatchPolicy::batchSize consecutive elements, see
+   * processElementBatch().
+   */
+  template< typename POLICY,
+            typename KERNEL_TYPE >
+  static
+  typename std::enable_if< isElementBatchPolicy< POLICY >::value, real64 >::type
+  kernelLaunch( localIndex const numElems,
+                KERNEL_TYPE const & kernelComponent )
+  {
+    GEOSX_MARK_FUNCTION;
+
+    using LAUNCH_POLICY = typename POLICY::launchPolicy;
+    constexpr localIndex batchSize = POLICY::batchSize;
+
+    // Define a RAJA reduction variable to get the maximum residual contribution.
+    RAJA::ReduceMax< ReducePolicy< LAUNCH_POLICY >, real64 > maxResidual( 0 );
+
+    localIndex const numBatches = ( numElems + batchSize - 1 ) / batchSize;
+    forAll< LAUNCH_POLICY >( numBatches,
+                             [=] ( localIndex const batch )
+    {
+      localIndex const firstElem = batch * batchSize;
+      if( firstElem + batchSize <= numElems )
+      {
+        // full batch, the lane loops have a compile time trip count
+        maxResidual.max( processElementBatch< batchSize >( firstElem,
+                                                           std::integral_constant< localIndex, batchSize >{},
+                                                           kernelComponent ) );
+      }
+      else
+      {
+        maxResidual.max( processElementBatch< batchSize >( firstElem, numElems - firstElem, kernelComponent ) );
+      }
+    } );
+    return maxResidual.get();
+  }
+
+  /**
+   * @brief Process a batch of consecutive elements.
+   * @tparam BATCH_SIZE The maximum number of elements in the batch.
+   * @tparam NUM_LANES The type of @p numLanes, either localIndex for a
+   *                   partial batch or std::integral_constant for a full one.
+   * @tparam KERNEL_TYPE The type of Kernel to execute.
+   * @param firstElem The first element of the batch.
+   * @param numLanes The number of elements in the batch.
+   * @param kernelComponent The instantiation of KERNEL_TYPE to execute.
+   * @return The maximum residual contribution of the batch.
+   *
+   * The stack variables of the elements of the batch are held together, and
+   * each phase of the kernel loops over the elements innermost. The elements
+   * are independent in all phases but complete(), which scatters into shared
+   * data and is therefore not marked for vectorization.
+   */
+  template< localIndex BATCH_SIZE,
+            typename NUM_LANES,
+            typename KERNEL_TYPE >
+  GEOSX_FORCE_INLINE
+  static real64 processElementBatch( localIndex const firstElem,
+                                     NUM_LANES const numLanes,
+                                     KERNEL_TYPE const & kernelComponent )
+  {
+    typename KERNEL_TYPE::StackVariables stack[ BATCH_SIZE ];
+
+    PRAGMA_OMP( "omp simd" )
+    for( localIndex lane = 0; lane < numLanes; ++lane )
+    {
+      kernelComponent.setup( firstElem + lane, stack[ lane ] );
+    }
+
+    for( integer q=0; q<numQuadraturePointsPerElem; ++q )
+    {
+      PRAGMA_OMP( "omp simd" )
+      for( localIndex lane = 0; lane < numLanes; ++lane )
+      {
+        kernelComponent.quadraturePointStateUpdate( firstElem + lane, q, stack[ lane ] );
+      }
+
+      PRAGMA_OMP( "omp simd" )
+      for( localIndex lane = 0; lane < numLanes; ++lane )
+      {
+        kernelComponent.quadraturePointJacobianContribution( firstElem + lane, q, stack[ lane ] );
+      }
+
+      PRAGMA_OMP( "omp simd" )
+      for( localIndex lane = 0; lane < numLanes; ++lane )
+      {
+        kernelComponent.quadraturePointResidualContribution( firstElem + lane, q, stack[ lane ] );
+      }
+    }
+
+    real64 maxResidual = 0;
+    for( localIndex lane = 0; lane < numLanes; ++lane )
+    {
+      maxResidual = std::max( maxResidual, kernelComponent.complete( firstElem + lane, stack[ lane ] ) );
+    }
+    return maxResidual;
+  }
+
 protected:
   /// The element to nodes map.
   typename SUBREGION_TYPE::NodeMapType::base_type::ViewTypeConst const m_elemsToNodes;
@@ -482,6 +631,114 @@ protected:
 };
 
 
+//*****************************************************************************
+/**
+ * @brief Split a list of elements into colors such that no two elements of
+ *        the same color share a node.
+ * @tparam ELEMS_TO_NODES The type of the element to nodes map.
+ * @param elemsToNodes The element to nodes map.
+ * @param elementList The list of elements to color.
+ * @param numNodes The number of nodes referenced by @p elemsToNodes.
+ * @param elementsByColor Filled with one array of elements per color.
+ *
+ * The elements are colored greedily in the order of @p elementList, which
+ * keeps the elements of each color in ascending order. Kernels launched over
+ * the elements of a single color may then scatter into nodal arrays without
+ * atomics, see forAllElementColors().
+ */
+template< typename ELEMS_TO_NODES >
+void colorElements( ELEMS_TO_NODES const & elemsToNodes,
+                    SortedArrayView< localIndex const > const & elementList,
+                    localIndex const numNodes,
+                    ArrayOfArrays< localIndex > & elementsByColor )
+{
+  GEOSX_MARK_FUNCTION;
+
+  localIndex const numNodesPerElem = elemsToNodes.size( 1 );
+
+  // Bit c of usedColors[ numWords * a + w ] is set if an element of color 64 * w + c touches node a.
+  localIndex numWords = 1;
+  std::vector< std::uint64_t > usedColors( numNodes, 0 );
+  std::vector< std::vector< localIndex > > colors;
+
+  for( localIndex const k : elementList )
+  {
+    localIndex color = -1;
+    for( localIndex w = 0; color < 0; ++w )
+    {
+      if( w == numWords )
+      {
+        std::vector< std::uint64_t > widerUsedColors( numNodes * ( numWords + 1 ), 0 );
+        for( localIndex a = 0; a < numNodes; ++a )
+        {
+          std::copy_n( &usedColors[ numWords * a ], numWords, &widerUsedColors[ ( numWords + 1 ) * a ] );
+        }
+        usedColors.swap( widerUsedColors );
+        ++numWords;
+      }
+
+      std::uint64_t used = 0;
+      for( localIndex a = 0; a < numNodesPerElem; ++a )
+      {
+        used |= usedColors[ numWords * elemsToNodes( k, a ) + w ];
+      }
+
+      if( ~used != 0 )
+      {
+        int bit = 0;
+        while( used & ( std::uint64_t( 1 ) << bit ) )
+        {
+          ++bit;
+        }
+        color = 64 * w + bit;
+      }
+    }
+
+    for( localIndex a = 0; a < numNodesPerElem; ++a )
+    {
+      usedColors[ numWords * elemsToNodes( k, a ) + color / 64 ] |= std::uint64_t( 1 ) << ( color % 64 );
+    }
+
+    if( color == LvArray::integerConversion< localIndex >( colors.size() ) )
+    {
+      colors.emplace_back();
+    }
+    colors[ color ].emplace_back( k );
+  }
+
+  elementsByColor.resize( 0 );
+  for( localIndex color = 0; color < LvArray::integerConversion< localIndex >( colors.size() ); ++color )
+  {
+    elementsByColor.appendArray( colors[ color ].size() );
+    std::copy( colors[ color ].begin(), colors[ color ].end(), elementsByColor[ color ].begin() );
+  }
+}
+
+/**
+ * @brief Launch a lambda over colored elements, one color after the other.
+ * @tparam POLICY The RAJA policy used to launch the elements of each color.
+ * @tparam LAMBDA The type of the lambda, called with the element index.
+ * @param elementsByColor The elements of each color, see colorElements().
+ * @param lambda The lambda to call on each element.
+ *
+ * Since the elements of a color share no node, the lambda may write to nodal
+ * data without atomics.
+ */
+template< typename POLICY, typename LAMBDA >
+void forAllElementColors( ArrayOfArraysView< localIndex const > const & elementsByColor,
+                          LAMBDA && lambda )
+{
+  for( localIndex color = 0; color < elementsByColor.size(); ++color )
+  {
+    forAll< POLICY >( elementsByColor.sizeOfArray( color ),
+                      [=] GEOSX_HOST_DEVICE ( localIndex const index )
+    {
+      lambda( elementsByColor[ color ][ index ] );
+    } );
+  }
+}
+
+
 //*****************************************************************************
 //*****************************************************************************
 //*****************************************************************************
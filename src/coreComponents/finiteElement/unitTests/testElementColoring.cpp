@@ -0,0 +1,150 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testElementColoring.cpp
+ */
+
+#include "managers/initialization.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include "gtest/gtest.h"
+
+#include "finiteElement/kernelInterface/KernelBase.hpp"
+
+using namespace geosx;
+using namespace finiteElement;
+
+/// Element to nodes map of a structured mesh of n x n x n hexahedra.
+static array2d< localIndex > structuredHexMesh( localIndex const n )
+{
+  localIndex const np = n + 1;
+  array2d< localIndex > elemsToNodes( n * n * n, 8 );
+  for( localIndex i = 0; i < n; ++i )
+  {
+    for( localIndex j = 0; j < n; ++j )
+    {
+      for( localIndex k = 0; k < n; ++k )
+      {
+        localIndex const elem = ( i * n + j ) * n + k;
+        localIndex a = 0;
+        for( localIndex di = 0; di < 2; ++di )
+        {
+          for( localIndex dj = 0; dj < 2; ++dj )
+          {
+            for( localIndex dk = 0; dk < 2; ++dk )
+            {
+              elemsToNodes( elem, a++ ) = ( ( i + di ) * np + j + dj ) * np + k + dk;
+            }
+          }
+        }
+      }
+    }
+  }
+  return elemsToNodes;
+}
+
+TEST( ElementColoring, colorsShareNoNode )
+{
+  localIndex const n = 6;
+  localIndex const numNodes = ( n + 1 ) * ( n + 1 ) * ( n + 1 );
+  array2d< localIndex > const elemsToNodes = structuredHexMesh( n );
+
+  // color every other element to exercise a list that is not the whole mesh
+  SortedArray< localIndex > elementList;
+  for( localIndex k = 0; k < elemsToNodes.size( 0 ); k += 2 )
+  {
+    elementList.insert( k );
+  }
+
+  ArrayOfArrays< localIndex > elementsByColor;
+  colorElements( elemsToNodes.toViewConst(), elementList.toViewConst(), numNodes, elementsByColor );
+
+  // greedy coloring of a structured hexahedral mesh needs at most 8 colors
+  EXPECT_LE( elementsByColor.size(), 8 );
+
+  localIndex numColored = 0;
+  for( localIndex color = 0; color < elementsByColor.size(); ++color )
+  {
+    std::vector< bool > touched( numNodes, false );
+    for( localIndex const k : elementsByColor[ color ] )
+    {
+      EXPECT_TRUE( elementList.contains( k ) );
+      for( localIndex a = 0; a < 8; ++a )
+      {
+        EXPECT_FALSE( touched[ elemsToNodes( k, a ) ] );
+        touched[ elemsToNodes( k, a ) ] = true;
+      }
+    }
+    numColored += elementsByColor.sizeOfArray( color );
+  }
+  EXPECT_EQ( numColored, elementList.size() );
+}
+
+TEST( ElementColoring, forAllElementColorsScatter )
+{
+  localIndex const n = 5;
+  localIndex const numNodes = ( n + 1 ) * ( n + 1 ) * ( n + 1 );
+  array2d< localIndex > const elemsToNodes = structuredHexMesh( n );
+
+  SortedArray< localIndex > elementList;
+  for( localIndex k = 0; k < elemsToNodes.size( 0 ); ++k )
+  {
+    elementList.insert( k );
+  }
+
+  ArrayOfArrays< localIndex > elementsByColor;
+  colorElements( elemsToNodes.toViewConst(), elementList.toViewConst(), numNodes, elementsByColor );
+
+  // scatter without atomics, each node must count the elements it belongs to
+  array1d< localIndex > valence( numNodes );
+  arrayView1d< localIndex > const & valenceView = valence.toView();
+  arrayView2d< localIndex const > const & elemsToNodesView = elemsToNodes.toViewConst();
+  forAllElementColors< parallelHostPolicy >( elementsByColor.toViewConst(),
+                                             [=] ( localIndex const k )
+  {
+    for( localIndex a = 0; a < 8; ++a )
+    {
+      valenceView[ elemsToNodesView( k, a ) ] += 1;
+    }
+  } );
+
+  array1d< localIndex > expected( numNodes );
+  for( localIndex k = 0; k < elemsToNodes.size( 0 ); ++k )
+  {
+    for( localIndex a = 0; a < 8; ++a )
+    {
+      expected[ elemsToNodes( k, a ) ] += 1;
+    }
+  }
+
+  for( localIndex a = 0; a < numNodes; ++a )
+  {
+    EXPECT_EQ( valence[ a ], expected[ a ] );
+  }
+}
+
+
+int main( int argc, char * argv[] )
+{
+  testing::InitGoogleTest();
+
+  basicSetup( argc, argv, false );
+
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
@@ -184,6 +184,55 @@ TEST( FiniteElementShapeFunctions, testKernelHost )
 }
 
 
+TEST( FiniteElementShapeFunctions, storedAndOnTheFlyDerivatives )
+{
+  constexpr localIndex numNodes = H1_Hexahedron_Lagrange1_GaussLegendre2::numNodes;
+  constexpr localIndex numQuadraturePoints = H1_Hexahedron_Lagrange1_GaussLegendre2::numQuadraturePoints;
+
+  real64 const xLocal[numNodes][3] = {
+    { -1.1, -1.3, -1.1 },
+    {  1.3, -1.1, -1.2 },
+    { -1.2, 1.1, -1.1 },
+    {  1.1, 1.2, -1.3 },
+    { -1.3, -1.2, 1.1 },
+    {  1.1, -1.3, 1.2 },
+    { -1.2, 1.2, 1.3 },
+    {  1.2, 1.1, 1.1 }
+  };
+
+  // Derivatives stored for two elements, the element of interest being the second one
+  localIndex const k = 1;
+  array4d< real64 > storedDNdX( 2, numQuadraturePoints, numNodes, 3 );
+  for( localIndex q = 0; q < numQuadraturePoints; ++q )
+  {
+    real64 dNdX[numNodes][3];
+    H1_Hexahedron_Lagrange1_GaussLegendre2::shapeFunctionDerivatives( q, xLocal, dNdX );
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        storedDNdX( k, q, a, i ) = dNdX[a][i];
+      }
+    }
+  }
+
+  for( localIndex q = 0; q < numQuadraturePoints; ++q )
+  {
+    real64 storedPath[numNodes][3];
+    real64 onTheFlyPath[numNodes][3];
+    FiniteElementBase::getShapeFunctionDerivatives< H1_Hexahedron_Lagrange1_GaussLegendre2, true >( k, q, xLocal, storedDNdX.toViewConst(), storedPath );
+    FiniteElementBase::getShapeFunctionDerivatives< H1_Hexahedron_Lagrange1_GaussLegendre2, false >( k, q, xLocal, storedDNdX.toViewConst(), onTheFlyPath );
+
+    for( localIndex a = 0; a < numNodes; ++a )
+    {
+      for( int i = 0; i < 3; ++i )
+      {
+        EXPECT_DOUBLE_EQ( storedPath[a][i], onTheFlyPath[a][i] );
+      }
+    }
+  }
+}
+
 
 using namespace geosx;
 int main( int argc, char * argv[] )
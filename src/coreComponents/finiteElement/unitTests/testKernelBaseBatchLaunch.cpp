@@ -0,0 +1,138 @@
+/*
+ * ------------------------------------------------------------------------------------------------------------
+ * SPDX-License-Identifier: LGPL-2.1-only
+ *
+ * Copyright (c) 2018-2020 Lawrence Livermore National Security LLC
+ * Copyright (c) 2018-2020 The Board of Trustees of the Leland Stanford Junior University
+ * Copyright (c) 2018-2020 Total, S.A
+ * Copyright (c) 2019-     GEOSX Contributors
+ * All rights reserved
+ *
+ * See top level LICENSE, COPYRIGHT, CONTRIBUTORS, NOTICE, and ACKNOWLEDGEMENTS files for details.
+ * ------------------------------------------------------------------------------------------------------------
+ */
+
+/**
+ * @file testKernelBaseBatchLaunch.cpp
+ */
+
+#include "managers/initialization.hpp"
+#include "rajaInterface/GEOS_RAJA_Interface.hpp"
+
+#include "gtest/gtest.h"
+
+#include "finiteElement/elementFormulations/H1_Hexahedron_Lagrange1_GaussLegendre2.hpp"
+#include "finiteElement/kernelInterface/KernelBase.hpp"
+
+using namespace geosx;
+using namespace finiteElement;
+
+using FE_TYPE = H1_Hexahedron_Lagrange1_GaussLegendre2;
+
+using KernelBaseType = KernelBase< CellElementSubRegion, constitutive::NullModel, FE_TYPE, 1, 1 >;
+
+/**
+ * Minimal kernel following the KernelBase interface: integrates a value per
+ * element with a weight per quadrature point and writes it in complete().
+ */
+struct TestKernel
+{
+  struct StackVariables
+  {
+    real64 value;
+  };
+
+  GEOSX_HOST_DEVICE
+  void setup( localIndex const GEOSX_UNUSED_PARAM( k ),
+              StackVariables & stack ) const
+  {
+    stack.value = 0;
+  }
+
+  GEOSX_HOST_DEVICE
+  void quadraturePointStateUpdate( localIndex const k,
+                                   localIndex const q,
+                                   StackVariables & stack ) const
+  {
+    stack.value += ( q + 1 ) * m_input[ k ];
+  }
+
+  GEOSX_HOST_DEVICE
+  void quadraturePointJacobianContribution( localIndex const GEOSX_UNUSED_PARAM( k ),
+                                            localIndex const GEOSX_UNUSED_PARAM( q ),
+                                            StackVariables & GEOSX_UNUSED_PARAM( stack ) ) const
+  {}
+
+  GEOSX_HOST_DEVICE
+  void quadraturePointResidualContribution( localIndex const GEOSX_UNUSED_PARAM( k ),
+                                            localIndex const q,
+                                            StackVariables & stack ) const
+  {
+    stack.value -= q;
+  }
+
+  GEOSX_HOST_DEVICE
+  real64 complete( localIndex const k,
+                   StackVariables & stack ) const
+  {
+    m_output[ k ] = stack.value;
+    return stack.value;
+  }
+
+  arrayView1d< real64 const > m_input;
+  arrayView1d< real64 > m_output;
+};
+
+template< typename POLICY >
+void testBatchLaunch( localIndex const numElems )
+{
+  array1d< real64 > input( numElems );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    input[ k ] = 0.5 * k - 3.0;
+  }
+
+  array1d< real64 > expected( numElems );
+  TestKernel const referenceKernel{ input.toViewConst(), expected.toView() };
+  real64 const expectedMax = KernelBaseType::kernelLaunch< serialPolicy, TestKernel >( numElems, referenceKernel );
+
+  array1d< real64 > output( numElems );
+  TestKernel const kernel{ input.toViewConst(), output.toView() };
+  real64 const maxResidual = KernelBaseType::kernelLaunch< POLICY, TestKernel >( numElems, kernel );
+
+  EXPECT_DOUBLE_EQ( maxResidual, expectedMax );
+  for( localIndex k = 0; k < numElems; ++k )
+  {
+    EXPECT_DOUBLE_EQ( output[ k ], expected[ k ] );
+  }
+}
+
+TEST( KernelBaseBatchLaunch, fullBatches )
+{
+  testBatchLaunch< ElementBatchPolicy< serialPolicy, 8 > >( 64 );
+}
+
+TEST( KernelBaseBatchLaunch, partialLastBatch )
+{
+  testBatchLaunch< ElementBatchPolicy< serialPolicy, 8 > >( 37 );
+  testBatchLaunch< ElementBatchPolicy< serialPolicy, 16 > >( 5 );
+}
+
+TEST( KernelBaseBatchLaunch, parallelHost )
+{
+  testBatchLaunch< ElementBatchPolicy< parallelHostPolicy, 4 > >( 101 );
+}
+
+
+int main( int argc, char * argv[] )
+{
+  testing::InitGoogleTest();
+
+  basicSetup( argc, argv, false );
+
+  int const result = RUN_ALL_TESTS();
+
+  basicCleanup();
+
+  return result;
+}
@@ -21,6 +21,7 @@
 
 #include "linearAlgebra/common.hpp"
 #include "linearAlgebra/interfaces/LinearOperator.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 //#include "LvArray/src/streamIO.hpp"
 
 namespace geosx
@@ -68,7 +69,8 @@ protected:
    */
   MatrixBase()
     : m_closed( true ),
-    m_assembled( false )
+    m_assembled( false ),
+    m_patternFingerprint( 0 )
   {}
 
   /**
@@ -246,6 +248,52 @@ protected:
       insert( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
     }
     close();
+
+    m_patternFingerprint = patternFingerprint( localMatrix );
+  }
+
+  /**
+   * @brief Update the values of a parallel matrix previously created from a local CRS matrix.
+   * @param localMatrix The input local matrix.
+   * @param comm The MPI communicator to use.
+   * @return @p true if the existing parallel structure has been reused, @p false if the matrix was recreated
+   *
+   * If the matrix is ready and the local sparsity pattern of @p localMatrix matches the one the
+   * matrix was last created from on every rank, only the coefficients are overwritten, which keeps
+   * the column maps and communication structures of the distributed matrix alive. Otherwise falls
+   * back to create().
+   * This is a collective call, all ranks take the same decision.
+   *
+   * @note Generic implementation compares a fingerprint of the pattern recorded by create()
+   *       and uses set() to copy values. Packages should override it with a direct copy into
+   *       their storage when possible.
+   */
+  virtual bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                             MPI_Comm const & comm )
+  {
+    localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+    // Only rank-local queries here: ranks may disagree on samePattern until the reduction below.
+    int const samePattern = ready()
+                            && m_patternFingerprint != 0
+                            && numLocalRows() == localMatrix.numRows()
+                            && m_patternFingerprint == patternFingerprint( localMatrix );
+
+    if( MpiWrapper::Min( samePattern, comm ) == 0 )
+    {
+      create( localMatrix, comm );
+      return false;
+    }
+
+    globalIndex const rankOffset = ilower();
+
+    open();
+    for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+    {
+      set( localRow + rankOffset, localMatrix.getColumns( localRow ), localMatrix.getEntries( localRow ) );
+    }
+    close();
+    return true;
   }
 
   ///@}
@@ -278,6 +326,7 @@ protected:
   {
     m_assembled = false;
     m_closed = true;
+    m_patternFingerprint = 0;
   }
 
   ///@}
@@ -943,6 +992,39 @@ protected:
   /// Flag indicating whether the matrix (sparsity pattern) has been assembled
   bool m_assembled;
 
+  /// Fingerprint of the local pattern the matrix was created from by create(), 0 if none
+  std::uint64_t m_patternFingerprint;
+
+  /**
+   * @brief Compute a fingerprint of the local sparsity pattern of a CRS matrix.
+   * @param localMatrix the local matrix
+   * @return a hash of the row lengths and column indices, never 0
+   *
+   * Costs one pass over the column indices, without copies or sorting.
+   */
+  static std::uint64_t patternFingerprint( CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+  {
+    // FNV-1a over 64-bit words
+    std::uint64_t hash = 14695981039346656037ULL;
+    auto const combine = [&hash]( std::uint64_t const word )
+    {
+      hash ^= word;
+      hash *= 1099511628211ULL;
+    };
+
+    combine( static_cast< std::uint64_t >( localMatrix.numRows() ) );
+    for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+    {
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+      combine( static_cast< std::uint64_t >( columns.size() ) );
+      for( localIndex k = 0; k < columns.size(); ++k )
+      {
+        combine( static_cast< std::uint64_t >( columns[k] ) );
+      }
+    }
+    return hash == 0 ? 1 : hash;
+  }
+
 };
 
 } // namespace geosx
@@ -151,6 +151,35 @@ protected:
    */
   virtual void create( arrayView1d< real64 const > const & localValues, MPI_Comm const & comm ) = 0;
 
+  /**
+   * @brief Update the values of a parallel vector from a local array.
+   * @param localValues local data to put into vector
+   * @param comm MPI communicator to use
+   * @return @p true if the existing vector has been reused, @p false if it was recreated
+   *
+   * If the vector is ready and its local size matches that of @p localValues on every rank,
+   * values are copied into existing storage. Otherwise falls back to create().
+   * This is a collective call, all ranks take the same decision.
+   */
+  virtual bool updateValues( arrayView1d< real64 const > const & localValues, MPI_Comm const & comm )
+  {
+    int const sameSize = ready() && localSize() == localValues.size();
+    if( MpiWrapper::Min( sameSize, comm ) == 0 )
+    {
+      reset();
+      create( localValues, comm );
+      return false;
+    }
+
+    localValues.move( LvArray::MemorySpace::CPU, false );
+    real64 * const data = extractLocalVector();
+    forAll< parallelHostPolicy >( localSize(), [=] ( localIndex const k )
+    {
+      data[k] = localValues[k];
+    } );
+    return true;
+  }
+
   ///@}
 
   /**
@@ -30,9 +30,10 @@ void HypreInterface::finalize()
 {}
 
 std::unique_ptr< PreconditionerBase< HypreInterface > >
-geosx::HypreInterface::createPreconditioner( LinearSolverParameters params )
+geosx::HypreInterface::createPreconditioner( LinearSolverParameters params,
+                                            DofManager const * const dofManager )
 {
-  return std::make_unique< HyprePreconditioner >( params );
+  return std::make_unique< HyprePreconditioner >( params, dofManager );
 }
 
 }
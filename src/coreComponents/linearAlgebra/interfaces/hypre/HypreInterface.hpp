@@ -51,10 +51,12 @@ struct HypreInterface
   /**
    * @brief Create a hypre-based preconditioner object.
    * @param params the preconditioner parameters
+   * @param dofManager optional pointer to the DofManager (used by some preconditioner types)
    * @return owning pointer to the newly created preconditioner
    */
   static std::unique_ptr< PreconditionerBase< HypreInterface > >
-  createPreconditioner( LinearSolverParameters params );
+  createPreconditioner( LinearSolverParameters params,
+                        DofManager const * const dofManager = nullptr );
 
   /// Alias for HypreMatrix
   using ParallelMatrix = HypreMatrix;
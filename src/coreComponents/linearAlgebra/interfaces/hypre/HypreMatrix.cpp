@@ -24,6 +24,7 @@
 #include "_hypre_parcsr_mv.h"
 #include "HypreUtils.hpp"
 
+#include <algorithm>
 #include <iomanip>
 
 namespace geosx
@@ -204,6 +205,113 @@ void HypreMatrix::createWithLocalSize( localIndex const localRows,
               m_ij_mat );
 }
 
+void HypreMatrix::create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                          MPI_Comm const & comm )
+{
+  MatrixBase::create( localMatrix, comm );
+
+  // Record the position of every ParCSR entry within the corresponding row of the source matrix,
+  // so that subsequent updates with the same sparsity can copy values directly into ParCSR storage.
+  hypre_CSRMatrix * const diag = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+  hypre_CSRMatrix * const offd = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+
+  HYPRE_Int const * const diag_i = hypre_CSRMatrixI( diag );
+  HYPRE_Int const * const diag_j = hypre_CSRMatrixJ( diag );
+  HYPRE_Int const * const offd_i = hypre_CSRMatrixI( offd );
+  HYPRE_Int const * const offd_j = hypre_CSRMatrixJ( offd );
+
+  HYPRE_BigInt const * const col_map_offd = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+  HYPRE_BigInt const first_col_diag = hypre_ParCSRMatrixFirstColDiag( m_parcsr_mat );
+
+  m_diagEntryPositions.resize( hypre_CSRMatrixNumNonzeros( diag ) );
+  m_offdEntryPositions.resize( hypre_CSRMatrixNumNonzeros( offd ) );
+
+  auto const findPosition = [&]( localIndex const localRow, globalIndex const col ) -> localIndex
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+    globalIndex const * const first = columns.dataIfContiguous();
+    return std::lower_bound( first, first + columns.size(), col ) - first;
+  };
+
+  for( localIndex localRow = 0; localRow < localMatrix.numRows(); ++localRow )
+  {
+    for( HYPRE_Int k = diag_i[localRow]; k < diag_i[localRow + 1]; ++k )
+    {
+      m_diagEntryPositions[k] = findPosition( localRow, diag_j[k] + first_col_diag );
+    }
+    for( HYPRE_Int k = offd_i[localRow]; k < offd_i[localRow + 1]; ++k )
+    {
+      m_offdEntryPositions[k] = findPosition( localRow, col_map_offd[offd_j[k]] );
+    }
+  }
+}
+
+bool HypreMatrix::updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                                MPI_Comm const & comm )
+{
+  localMatrix.move( LvArray::MemorySpace::CPU, false );
+
+  int samePattern = ready() && numLocalRows() == localMatrix.numRows();
+
+  hypre_CSRMatrix * diag = nullptr;
+  hypre_CSRMatrix * offd = nullptr;
+  if( samePattern )
+  {
+    diag = hypre_ParCSRMatrixDiag( m_parcsr_mat );
+    offd = hypre_ParCSRMatrixOffd( m_parcsr_mat );
+    samePattern = m_diagEntryPositions.size() == hypre_CSRMatrixNumNonzeros( diag )
+                  && m_offdEntryPositions.size() == hypre_CSRMatrixNumNonzeros( offd );
+  }
+
+  // Copy values straight into ParCSR storage while checking that column indices still match;
+  // if they don't, the values written so far are discarded when the matrix is recreated below.
+  if( samePattern )
+  {
+    HYPRE_Int const * const diag_i = hypre_CSRMatrixI( diag );
+    HYPRE_Int const * const diag_j = hypre_CSRMatrixJ( diag );
+    HYPRE_Real * const diag_data = hypre_CSRMatrixData( diag );
+    HYPRE_Int const * const offd_i = hypre_CSRMatrixI( offd );
+    HYPRE_Int const * const offd_j = hypre_CSRMatrixJ( offd );
+    HYPRE_Real * const offd_data = hypre_CSRMatrixData( offd );
+
+    HYPRE_BigInt const * const col_map_offd = hypre_ParCSRMatrixColMapOffd( m_parcsr_mat );
+    HYPRE_BigInt const first_col_diag = hypre_ParCSRMatrixFirstColDiag( m_parcsr_mat );
+
+    for( localIndex localRow = 0; localRow < localMatrix.numRows() && samePattern; ++localRow )
+    {
+      arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( localRow );
+      arraySlice1d< real64 const > const entries = localMatrix.getEntries( localRow );
+
+      localIndex const rowLength = ( diag_i[localRow + 1] - diag_i[localRow] ) + ( offd_i[localRow + 1] - offd_i[localRow] );
+      if( rowLength != columns.size() )
+      {
+        samePattern = 0;
+        break;
+      }
+
+      for( HYPRE_Int k = diag_i[localRow]; k < diag_i[localRow + 1]; ++k )
+      {
+        localIndex const pos = m_diagEntryPositions[k];
+        samePattern = samePattern && pos < rowLength && columns[pos] == diag_j[k] + first_col_diag;
+        diag_data[k] = samePattern ? entries[pos] : 0.0;
+      }
+      for( HYPRE_Int k = offd_i[localRow]; k < offd_i[localRow + 1]; ++k )
+      {
+        localIndex const pos = m_offdEntryPositions[k];
+        samePattern = samePattern && pos < rowLength && columns[pos] == col_map_offd[offd_j[k]];
+        offd_data[k] = samePattern ? entries[pos] : 0.0;
+      }
+    }
+  }
+
+  if( MpiWrapper::Min( samePattern, comm ) == 0 )
+  {
+    create( localMatrix, comm );
+    return false;
+  }
+  return true;
+}
+
 void HypreMatrix::set( real64 const value )
 {
   GEOSX_LAI_ASSERT( ready() );
@@ -221,6 +329,8 @@ void HypreMatrix::reset()
     m_ij_mat = nullptr;
     m_parcsr_mat = nullptr;
   }
+  m_diagEntryPositions.clear();
+  m_offdEntryPositions.clear();
 }
 
 void HypreMatrix::zero()
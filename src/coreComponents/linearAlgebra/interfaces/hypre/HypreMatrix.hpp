@@ -96,7 +96,6 @@ public:
 
   using MatrixBase::createWithLocalSize;
   using MatrixBase::createWithGlobalSize;
-  using MatrixBase::create;
   using MatrixBase::closed;
   using MatrixBase::assembled;
   using MatrixBase::insertable;
@@ -114,6 +113,12 @@ public:
                                      localIndex const maxEntriesPerRow,
                                      MPI_Comm const & comm ) override;
 
+  virtual void create( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                       MPI_Comm const & comm ) override;
+
+  virtual bool updateValues( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+                             MPI_Comm const & comm ) override;
+
   virtual void open() override;
 
   virtual void close() override;
@@ -336,6 +341,18 @@ private:
    */
   HYPRE_ParCSRMatrix m_parcsr_mat = nullptr;
 
+  /**
+   * Position of each entry of the ParCSR diagonal block within the corresponding row of the
+   * local CRS matrix the matrix was created from (used by updateValues()).
+   */
+  array1d< localIndex > m_diagEntryPositions;
+
+  /**
+   * Position of each entry of the ParCSR off-diagonal block within the corresponding row of the
+   * local CRS matrix the matrix was created from (used by updateValues()).
+   */
+  array1d< localIndex > m_offdEntryPositions;
+
 };
 
 } // namespace geosx
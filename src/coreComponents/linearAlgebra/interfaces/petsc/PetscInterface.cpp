@@ -38,7 +38,8 @@ void PetscInterface::finalize()
 }
 
 std::unique_ptr< PreconditionerBase< PetscInterface > >
-PetscInterface::createPreconditioner( LinearSolverParameters params )
+PetscInterface::createPreconditioner( LinearSolverParameters params,
+                                      DofManager const * const GEOSX_UNUSED_PARAM( dofManager ) )
 {
   return std::make_unique< PetscPreconditioner >( params );
 }
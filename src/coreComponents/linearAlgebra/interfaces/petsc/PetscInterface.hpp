@@ -55,10 +55,12 @@ struct PetscInterface
   /**
    * @brief Create a PETSc-based preconditioner object.
    * @param params the parameters for preconditioner
+   * @param dofManager optional pointer to the DofManager (unused by this package)
    * @return owning pointer to the newly created preconditioner
    */
   static std::unique_ptr< PreconditionerBase< PetscInterface > >
-  createPreconditioner( LinearSolverParameters params );
+  createPreconditioner( LinearSolverParameters params,
+                        DofManager const * const dofManager = nullptr );
 
   /// Alias for PetscMatrix
   using ParallelMatrix = PetscMatrix;
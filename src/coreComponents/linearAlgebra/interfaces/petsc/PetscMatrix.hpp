@@ -86,6 +86,7 @@ public:
   using MatrixBase::createWithLocalSize;
   using MatrixBase::createWithGlobalSize;
   using MatrixBase::create;
+  using MatrixBase::updateValues;
   using MatrixBase::closed;
   using MatrixBase::assembled;
   using MatrixBase::insertable;
@@ -99,6 +99,7 @@ public:
   using VectorBase::closed;
   using VectorBase::ready;
   using VectorBase::extract;
+  using VectorBase::updateValues;
 
   virtual bool created() const override;
 
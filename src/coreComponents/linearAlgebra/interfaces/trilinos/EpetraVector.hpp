@@ -87,6 +87,7 @@ public:
   using VectorBase::closed;
   using VectorBase::ready;
   using VectorBase::extract;
+  using VectorBase::updateValues;
 
   virtual bool created() const override;
 
@@ -30,7 +30,8 @@ void TrilinosInterface::finalize()
 {}
 
 std::unique_ptr< PreconditionerBase< TrilinosInterface > >
-TrilinosInterface::createPreconditioner( LinearSolverParameters params )
+TrilinosInterface::createPreconditioner( LinearSolverParameters params,
+                                         DofManager const * const GEOSX_UNUSED_PARAM( dofManager ) )
 {
   return std::make_unique< TrilinosPreconditioner >( params );
 }
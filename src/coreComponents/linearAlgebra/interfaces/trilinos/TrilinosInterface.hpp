@@ -51,10 +51,12 @@ struct TrilinosInterface
   /**
    * @brief Create a Trilinos-based preconditioner object.
    * @param params the preconditioner parameters
+   * @param dofManager optional pointer to the DofManager (unused by this package)
    * @return an owning pointer to the newly created preconditioner
    */
   static std::unique_ptr< PreconditionerBase< TrilinosInterface > >
-  createPreconditioner( LinearSolverParameters params );
+  createPreconditioner( LinearSolverParameters params,
+                        DofManager const * const dofManager = nullptr );
 
   /// Alias for EpetraMatrix
   using ParallelMatrix = EpetraMatrix;
@@ -49,14 +49,18 @@ void BiCGSTABsolver< VECTOR >::solve( Vector const & b,
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_tolerance;
 
+  // Work vectors are kept between solves
+  prepareWorkVectors( b, 9 );
+
   // Define vectors
-  VectorTemp r( x );
+  VectorTemp & r = m_workVectors[0];
 
   // Compute initial rk
   m_operator.residual( x, b, r );
 
   // Define vectors
-  VectorTemp r0( r );
+  VectorTemp & r0 = m_workVectors[1];
+  r0.copy( r );
 
   // Define scalars and reinitialize some
   real64 rho_old = r.dot( r0 );
@@ -64,13 +68,13 @@ void BiCGSTABsolver< VECTOR >::solve( Vector const & b,
   real64 omega = 1.0;
 
   // Define temporary vectors
-  VectorTemp v = createTempVector( r );
-  VectorTemp p = createTempVector( r );
-  VectorTemp y = createTempVector( r );
-  VectorTemp z = createTempVector( r );
-  VectorTemp t = createTempVector( r );
-  VectorTemp s = createTempVector( r );
-  VectorTemp q = createTempVector( x );
+  VectorTemp & v = m_workVectors[2];
+  VectorTemp & p = m_workVectors[3];
+  VectorTemp & y = m_workVectors[4];
+  VectorTemp & z = m_workVectors[5];
+  VectorTemp & t = m_workVectors[6];
+  VectorTemp & s = m_workVectors[7];
+  VectorTemp & q = m_workVectors[8];
 
   v.zero();
   p.zero();
@@ -101,7 +101,9 @@ protected:
   using Base::m_logLevel;
   using Base::m_result;
   using Base::m_residualNorms;
+  using Base::m_workVectors;
   using Base::createTempVector;
+  using Base::prepareWorkVectors;
   using Base::logProgress;
   using Base::logResult;
 
@@ -48,8 +48,10 @@ CGsolver< VECTOR >::CGsolver( LinearOperator< Vector > const & A,
                               LinearOperator< Vector > const & M,
                               real64 const tolerance,
                               localIndex const maxIterations,
-                              integer const verbosity )
-  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity )
+                              integer const verbosity,
+                              integer const pipelined )
+  : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
+  m_pipelined( pipelined )
 {}
 
 // ----------------------------
@@ -65,23 +67,32 @@ template< typename VECTOR >
 void CGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
 
 {
+  if( m_pipelined )
+  {
+    solvePipelined( b, x );
+    return;
+  }
+
   Stopwatch watch;
 
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_tolerance;
 
+  // Work vectors are kept between solves
+  prepareWorkVectors( b, 4 );
+
   // Define residual vector
-  VectorTemp r = createTempVector( b );
+  VectorTemp & r = m_workVectors[0];
 
   // Compute initial rk =  b - Ax
   m_operator.residual( x, b, r );
 
   // Preconditioning
-  VectorTemp z = createTempVector( x );
+  VectorTemp & z = m_workVectors[1];
 
   // Search direction
-  VectorTemp p = createTempVector( z );
-  VectorTemp Ap = createTempVector( z );
+  VectorTemp & p = m_workVectors[2];
+  VectorTemp & Ap = m_workVectors[3];
 
   // Keep old value of preconditioned residual norm
   real64 tau_old = 0.0;
@@ -142,6 +153,119 @@ void CGsolver< VECTOR >::solve( Vector const & b, Vector & x ) const
   m_residualNorms.resize( m_result.numIterations + 1 );
 }
 
+// ----------------------------
+// Pipelined CG solver
+// ----------------------------
+// Variant of Ghysels and Vanroose, "Hiding global synchronization latency
+// in the preconditioned Conjugate Gradient algorithm" (2014). The dot products
+// of an iteration (including the residual norm) are reduced together, and the
+// non-blocking reduction is overlapped with the preconditioner and operator
+// application. It needs more vectors and axpys than the standard method and
+// the recurrences are slightly less stable, so it pays off when reductions dominate.
+template< typename VECTOR >
+void CGsolver< VECTOR >::solvePipelined( Vector const & b, Vector & x ) const
+{
+  Stopwatch watch;
+
+  // Compute the target absolute tolerance
+  real64 const absTol = b.norm2() * m_tolerance;
+
+  // Work vectors are kept between solves
+  prepareWorkVectors( b, 9 );
+
+  VectorTemp & r = m_workVectors[0];
+  VectorTemp & u = m_workVectors[1];
+  VectorTemp & w = m_workVectors[2];
+  VectorTemp & m = m_workVectors[3];
+  VectorTemp & n = m_workVectors[4];
+  VectorTemp & z = m_workVectors[5];
+  VectorTemp & q = m_workVectors[6];
+  VectorTemp & s = m_workVectors[7];
+  VectorTemp & p = m_workVectors[8];
+
+  // Compute initial rk = b - Ax, uk = Mrk, wk = Auk
+  m_operator.residual( x, b, r );
+  m_precond.apply( r, u );
+  m_operator.apply( u, w );
+
+  z.zero();
+  q.zero();
+  s.zero();
+  p.zero();
+
+  MPI_Comm const comm = getComm( b );
+
+  real64 gamma_old = 0.0;
+  real64 alpha_old = 0.0;
+
+  m_result.status = LinearSolverResult::Status::NotConverged;
+  m_result.numIterations = 0;
+  m_residualNorms.resize( m_maxIterations + 1 );
+
+  localIndex k;
+  real64 rnorm = 0.0;
+
+  for( k = 0; k <= m_maxIterations; ++k )
+  {
+    // Start the reduction of (r,u), (w,u) and (r,r)
+    real64 const localDots[3] = { localDot( r, u ), localDot( w, u ), localDot( r, r ) };
+    real64 dots[3];
+    MPI_Request request;
+    MpiWrapper::iAllReduce( localDots, dots, 3, MPI_SUM, comm, &request );
+
+    // Overlap it with mk = Mwk, nk = Amk
+    m_precond.apply( w, m );
+    m_operator.apply( m, n );
+
+    MpiWrapper::Wait( &request, MPI_STATUS_IGNORE );
+
+    real64 const gamma = dots[0];
+    real64 const delta = dots[1];
+
+    rnorm = std::sqrt( dots[2] );
+    logProgress( k, rnorm );
+
+    // Convergence check on ||rk||/||b||
+    if( rnorm < absTol )
+    {
+      m_result.status = LinearSolverResult::Status::Success;
+      break;
+    }
+
+    // Compute alpha and beta
+    real64 const beta = k > 0 ? gamma / gamma_old : 0.0;
+    real64 const denom = k > 0 ? delta - beta * gamma / alpha_old : delta;
+    GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( denom );
+    if( m_result.status == LinearSolverResult::Status::Breakdown )
+    {
+      break;
+    }
+    real64 const alpha = gamma / denom;
+
+    // Update recurrences z = n + beta*z, q = m + beta*q, s = w + beta*s, p = u + beta*p
+    z.axpby( 1.0, n, beta );
+    q.axpby( 1.0, m, beta );
+    s.axpby( 1.0, w, beta );
+    p.axpby( 1.0, u, beta );
+
+    // Update x = x + alpha*p, r = r - alpha*s, u = u - alpha*q, w = w - alpha*z
+    x.axpby( alpha, p, 1.0 );
+    r.axpby( -alpha, s, 1.0 );
+    u.axpby( -alpha, q, 1.0 );
+    w.axpby( -alpha, z, 1.0 );
+
+    gamma_old = gamma;
+    alpha_old = alpha;
+  }
+
+  m_result.numIterations = k;
+  m_result.residualReduction = rnorm / absTol * m_tolerance;
+  m_result.solveTime = watch.elapsedTime();
+
+  logResult();
+  m_residualNorms.resize( m_result.numIterations + 1 );
+}
+
 // END_RST_NARRATIVE
 
 // -----------------------
@@ -56,12 +56,15 @@ public:
    * @param [in] tolerance relative residual norm reduction tolerance.
    * @param [in] maxIterations maximum number of Krylov iterations.
    * @param [in] verbosity solver verbosity level.
+   * @param [in] pipelined whether to use the pipelined variant, which overlaps the single
+   *             global reduction of each iteration with the preconditioner and operator application.
    */
   CGsolver( LinearOperator< Vector > const & A,
             LinearOperator< Vector > const & M,
             real64 const tolerance,
             localIndex const maxIterations,
-            integer const verbosity = 0 );
+            integer const verbosity = 0,
+            integer const pipelined = false );
 
   /**
    * @brief Virtual destructor.
@@ -84,7 +87,7 @@ public:
 
   virtual string methodName() const override final
   {
-    return "CG";
+    return m_pipelined ? "PipelinedCG" : "CG";
   };
 
   ///@}
@@ -101,9 +104,23 @@ protected:
   using Base::m_logLevel;
   using Base::m_result;
   using Base::m_residualNorms;
+  using Base::m_workVectors;
   using Base::createTempVector;
+  using Base::prepareWorkVectors;
   using Base::logProgress;
   using Base::logResult;
+  using Base::localDot;
+  using Base::getComm;
+
+  /**
+   * @brief Solve preconditioned system with the pipelined variant of the method.
+   * @param [in] b system right hand side.
+   * @param [inout] x system solution (input = initial guess, output = solution).
+   */
+  void solvePipelined( Vector const & b, Vector & x ) const;
+
+  /// Whether the pipelined variant is used
+  integer m_pipelined;
 
 };
 
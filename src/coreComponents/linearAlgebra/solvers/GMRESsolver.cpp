@@ -31,13 +31,20 @@ GMRESsolver< VECTOR >::GMRESsolver( LinearOperator< Vector > const & A,
                                     real64 tolerance,
                                     localIndex maxIterations,
                                     integer verbosity,
-                                    localIndex maxRestart )
+                                    localIndex maxRestart,
+                                    LinearSolverParameters::Orthogonalization orthogonalization )
   : KrylovSolver< VECTOR >( A, M, tolerance, maxIterations, verbosity ),
   m_maxRestart( maxRestart ),
-  m_kspace( m_maxRestart + 1 ),
-  m_kspaceInitialized( false )
+  m_orthogonalization( orthogonalization )
 {
   GEOSX_ERROR_IF_LE_MSG( m_maxRestart, 0, "GMRES: max number of restart iterations must be positive." );
+
+  m_hessenberg.resize( m_maxRestart + 1, m_maxRestart );
+  m_rotationCos.resize( m_maxRestart + 1 );
+  m_rotationSin.resize( m_maxRestart + 1 );
+  m_projectedResidual.resize( m_maxRestart + 1 );
+  m_localDots.resize( m_maxRestart + 1 );
+  m_dots.resize( m_maxRestart + 1 );
 }
 
 template< typename VECTOR >
@@ -92,40 +99,91 @@ void Backsolve( localIndex const k,
 }
 
 template< typename VECTOR >
-void GMRESsolver< VECTOR >::solve( Vector const & b,
-                                   Vector & x ) const
+void GMRESsolver< VECTOR >::orthogonalize( localIndex const j,
+                                           VectorTemp const * const kspace,
+                                           VectorTemp & w ) const
 {
-  // We create Krylov subspace vectors once using the size and partitioning of b.
-  // It is assumed that on every repeated call to solve() input vectors will keep
-  // the same (or at least compatible) size and partitioning.
-  if( !m_kspaceInitialized )
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > & H = m_hessenberg;
+
+  if( m_orthogonalization == LinearSolverParameters::Orthogonalization::mgs )
   {
-    for( localIndex i = 0; i < m_maxRestart + 1; ++i )
+    // Modified Gram-Schmidt: one global reduction per basis vector
+    for( localIndex i = 0; i <= j; ++i )
     {
-      m_kspace[i] = createTempVector( b );
+      H( i, j ) = w.dot( kspace[i] );
+      w.axpby( -H( i, j ), kspace[i], 1.0 );
     }
+    H( j+1, j ) = w.norm2();
+    return;
+  }
+
+  // Classical Gram-Schmidt with one reorthogonalization pass: all projections of a pass are
+  // reduced together. The second pass also reduces ||w||^2, so that the norm of the orthogonalized
+  // vector follows from the Pythagorean identity instead of a third reduction.
+  MPI_Comm const comm = getComm( w );
+
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    m_localDots[i] = localDot( w, kspace[i] );
+  }
+  MpiWrapper::allReduce( m_localDots.data(), m_dots.data(), j + 1, MPI_SUM, comm );
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    H( i, j ) = m_dots[i];
+    w.axpy( -m_dots[i], kspace[i] );
   }
 
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    m_localDots[i] = localDot( w, kspace[i] );
+  }
+  m_localDots[j+1] = localDot( w, w );
+  MpiWrapper::allReduce( m_localDots.data(), m_dots.data(), j + 2, MPI_SUM, comm );
+
+  real64 correctionNorm2 = 0.0;
+  for( localIndex i = 0; i <= j; ++i )
+  {
+    H( i, j ) += m_dots[i];
+    w.axpy( -m_dots[i], kspace[i] );
+    correctionNorm2 += m_dots[i] * m_dots[i];
+  }
+
+  // Fall back to an explicit norm if the identity suffers from cancellation
+  real64 const normSquared = m_dots[j+1] - correctionNorm2;
+  H( j+1, j ) = normSquared > 0.5 * m_dots[j+1] ? std::sqrt( normSquared ) : w.norm2();
+}
+
+template< typename VECTOR >
+void GMRESsolver< VECTOR >::solve( Vector const & b,
+                                   Vector & x ) const
+{
+  // We create work and Krylov subspace vectors once using the size and partitioning of b.
+  // They are only re-created if a subsequent call to solve() uses vectors of a different size.
+  prepareWorkVectors( b, m_maxRestart + 4 );
+
   Stopwatch watch;
 
   // Compute the target absolute tolerance
   real64 const absTol = b.norm2() * m_tolerance;
 
   // Define vectors
-  VectorTemp r = createTempVector( b );
-  VectorTemp w = createTempVector( b );
-  VectorTemp z = createTempVector( b );
+  VectorTemp & r = m_workVectors[0];
+  VectorTemp & w = m_workVectors[1];
+  VectorTemp & z = m_workVectors[2];
+
+  // Krylov subspace basis is stored after the work vectors
+  VectorTemp * const kspace = m_workVectors.data() + 3;
 
   // Compute initial rk
   m_operator.residual( x, b, r );
 
-  // Create upper Hessenberg matrix
-  array2d< real64, MatrixLayout::COL_MAJOR_PERM > H( m_maxRestart + 1, m_maxRestart );
+  // Upper Hessenberg matrix
+  array2d< real64, MatrixLayout::COL_MAJOR_PERM > & H = m_hessenberg;
 
-  // Create plane rotation storage
-  array1d< real64 > c( m_maxRestart + 1 );
-  array1d< real64 > s( m_maxRestart + 1 );
-  array1d< real64 > g( m_maxRestart + 1 );
+  // Plane rotation storage
+  array1d< real64 > & c = m_rotationCos;
+  array1d< real64 > & s = m_rotationSin;
+  array1d< real64 > & g = m_projectedResidual;
 
   m_result.status = LinearSolverResult::Status::NotConverged;
   m_residualNorms.resize( m_maxIterations + 1 );
@@ -138,7 +196,7 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
     // Re-initialize Krylov subspace
     g.setValues< serialPolicy >( 0.0 );
     g[0] = r.norm2();
-    m_kspace[0].axpby( 1.0 / g[0], r, 0.0 );
+    kspace[0].axpby( 1.0 / g[0], r, 0.0 );
 
     localIndex j;
     for( j = 0; j < m_maxRestart && k <= m_maxIterations; ++j, ++k )
@@ -155,19 +213,13 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
       }
 
       // Compute the new vector
-      m_precond.apply( m_kspace[j], z );
+      m_precond.apply( kspace[j], z );
       m_operator.apply( z, w );
 
       // Orthogonalization
-      for( localIndex i = 0; i <= j; ++i )
-      {
-        H( i, j ) = w.dot( m_kspace[i] );
-        w.axpby( -H( i, j ), m_kspace[i], 1.0 );
-      }
-
-      H( j+1, j ) = w.norm2();
+      orthogonalize( j, kspace, w );
       GEOSX_KRYLOV_BREAKDOWN_IF_ZERO( H( j + 1, j ) );
-      m_kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
+      kspace[j+1].axpby( 1.0 / H( j+1, j ), w, 0.0 );
 
       // Apply all previous rotations to the new column
       for( localIndex i = 0; i < j; ++i )
@@ -186,7 +238,7 @@ void GMRESsolver< VECTOR >::solve( Vector const & b,
     w.zero();
     for( localIndex i = 0; i < j; ++i )
     {
-      w.axpy( g[i], m_kspace[i] );
+      w.axpy( g[i], kspace[i] );
     }
     m_precond.apply( w, z );
 
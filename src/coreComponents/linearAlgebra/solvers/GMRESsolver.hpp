@@ -57,13 +57,15 @@ public:
    * @param[in] maxIterations maximum number of Krylov iterations
    * @param[in] verbosity     solver verbosity level
    * @param[in] maxRestart    number of iterations until restart
+   * @param[in] orthogonalization orthogonalization scheme of the Krylov basis
    */
   GMRESsolver( LinearOperator< Vector > const & matrix,
                LinearOperator< Vector > const & precond,
                real64 const tolerance,
                localIndex const maxIterations,
                integer const verbosity = 0,
-               localIndex const maxRestart = 100 );
+               localIndex const maxRestart = 100,
+               LinearSolverParameters::Orthogonalization const orthogonalization = LinearSolverParameters::Orthogonalization::mgs );
 
   /**
    * @brief Virtual destructor.
@@ -103,18 +105,49 @@ protected:
   using Base::m_logLevel;
   using Base::m_result;
   using Base::m_residualNorms;
+  using Base::m_workVectors;
   using Base::createTempVector;
+  using Base::prepareWorkVectors;
   using Base::logProgress;
   using Base::logResult;
+  using Base::localDot;
+  using Base::getComm;
+
+  /**
+   * @brief Orthogonalize a new vector against the current Krylov basis.
+   * @param j index of the last vector of the basis
+   * @param kspace the Krylov basis vectors
+   * @param w the vector to orthogonalize (output: orthogonal to the basis, not normalized)
+   *
+   * Fills column @p j of the Hessenberg matrix, including the norm of the orthogonalized vector.
+   */
+  void orthogonalize( localIndex const j,
+                      VectorTemp const * const kspace,
+                      VectorTemp & w ) const;
 
   /// Number of iterations needed to restart GMRES
   localIndex m_maxRestart;
 
-  /// Storage for Krylov subspace vectors
-  array1d< VectorTemp > m_kspace;
+  /// Orthogonalization scheme of the Krylov basis
+  LinearSolverParameters::Orthogonalization m_orthogonalization;
+
+  /// Upper Hessenberg matrix of the Arnoldi process
+  mutable array2d< real64, MatrixLayout::COL_MAJOR_PERM > m_hessenberg;
+
+  /// Cosines of Givens plane rotations
+  mutable array1d< real64 > m_rotationCos;
+
+  /// Sines of Givens plane rotations
+  mutable array1d< real64 > m_rotationSin;
+
+  /// Right-hand side of the projected least squares problem
+  mutable array1d< real64 > m_projectedResidual;
+
+  /// Local contributions to the dot products reduced together (classical Gram-Schmidt)
+  mutable array1d< real64 > m_localDots;
 
-  /// Flag indicating whether kspace vectors have been created
-  bool m_kspaceInitialized;
+  /// Globally reduced dot products (classical Gram-Schmidt)
+  mutable array1d< real64 > m_dots;
 };
 
 } // namespace geosx
@@ -36,7 +36,8 @@ KrylovSolver< VECTOR >::KrylovSolver( LinearOperator< Vector > const & matrix,
   m_precond( precond ),
   m_tolerance( tolerance ),
   m_maxIterations( maxIterations ),
-  m_logLevel( verbosity )
+  m_logLevel( verbosity ),
+  m_workVectorsLocalSize( -1 )
 {
   GEOSX_ERROR_IF_LE_MSG( m_maxIterations, 0, "Krylov solver: max number of iteration must be positive." );
   GEOSX_LAI_ASSERT_EQ( m_operator.numGlobalRows(), m_precond.numGlobalRows() );
@@ -58,7 +59,8 @@ KrylovSolver< VECTOR >::Create( LinearSolverParameters const & parameters,
                                                      precond,
                                                      parameters.krylov.relTolerance,
                                                      parameters.krylov.maxIterations,
-                                                     parameters.logLevel );
+                                                     parameters.logLevel,
+                                                     parameters.krylov.usePipelined );
     }
     case LinearSolverParameters::SolverType::bicgstab:
     {
@@ -75,7 +77,8 @@ KrylovSolver< VECTOR >::Create( LinearSolverParameters const & parameters,
                                                         parameters.krylov.relTolerance,
                                                         parameters.krylov.maxIterations,
                                                         parameters.logLevel,
-                                                        parameters.krylov.maxRestart );
+                                                        parameters.krylov.maxRestart,
+                                                        parameters.krylov.orthogonalization );
     }
     default:
     {
@@ -24,6 +24,7 @@
 #include "linearAlgebra/utilities/BlockOperatorView.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/utilities/LinearSolverResult.hpp"
+#include "mpiCommunications/MpiWrapper.hpp"
 
 namespace geosx
 {
@@ -123,6 +124,17 @@ public:
     return m_residualNorms;
   }
 
+  /**
+   * @brief Set the relative residual norm reduction tolerance used by subsequent solves.
+   * @param tolerance the new tolerance value
+   *
+   * Allows a solver instance kept across Newton iterations to follow adaptive linear tolerances.
+   */
+  void setTolerance( real64 const tolerance )
+  {
+    m_tolerance = tolerance;
+  }
+
   /**
    * @brief Get log level.
    * @return integer value of the log level
@@ -153,6 +165,23 @@ private:
       v.createWithLocalSize( src.localSize(), src.getComm() );
       return v;
     }
+
+    static real64 localDot( VEC const & x, VEC const & y )
+    {
+      real64 const * const xValues = x.extractLocalVector();
+      real64 const * const yValues = y.extractLocalVector();
+      real64 result = 0.0;
+      for( localIndex i = 0; i < x.localSize(); ++i )
+      {
+        result += xValues[i] * yValues[i];
+      }
+      return result;
+    }
+
+    static MPI_Comm getComm( VEC const & x )
+    {
+      return x.getComm();
+    }
   };
 
   template< typename VEC >
@@ -169,6 +198,21 @@ private:
       }
       return v;
     }
+
+    static real64 localDot( BlockVectorView< VEC > const & x, BlockVectorView< VEC > const & y )
+    {
+      real64 result = 0.0;
+      for( localIndex i = 0; i < x.blockSize(); ++i )
+      {
+        result += VectorStorageHelper< VEC >::localDot( x.block( i ), y.block( i ) );
+      }
+      return result;
+    }
+
+    static MPI_Comm getComm( BlockVectorView< VEC > const & x )
+    {
+      return x.block( 0 ).getComm();
+    }
   };
 
   ///@endcond DO_NOT_DOCUMENT
@@ -190,6 +234,54 @@ protected:
     return VectorStorageHelper< VECTOR >::createFrom( src );
   }
 
+  /**
+   * @brief Compute the local (this rank's) part of a dot product.
+   * @param x the first vector
+   * @param y the second vector
+   * @return the dot product of the locally owned entries of @p x and @p y
+   *
+   * Used together with a single (possibly non-blocking) reduction to compute several
+   * dot products at the cost of one global synchronization.
+   */
+  static real64 localDot( Vector const & x, Vector const & y )
+  {
+    return VectorStorageHelper< VECTOR >::localDot( x, y );
+  }
+
+  /**
+   * @brief Get the communicator over which a vector is distributed.
+   * @param x the vector
+   * @return the MPI communicator of @p x
+   */
+  static MPI_Comm getComm( Vector const & x )
+  {
+    return VectorStorageHelper< VECTOR >::getComm( x );
+  }
+
+  /**
+   * @brief Make sure the set of work vectors kept by the solver is compatible with a source vector.
+   * @param src the source vector, whose size and parallel distribution will be used
+   * @param numVectors number of work vectors needed by the method
+   *
+   * Work vectors are created on first use and kept between calls to solve(), so that
+   * repeated solves on the same operator do not reallocate them. They are only re-created
+   * when the number of vectors requested or the local size of @p src changes on any rank.
+   * This is a collective call, since the re-creation is.
+   */
+  void prepareWorkVectors( Vector const & src, localIndex const numVectors ) const
+  {
+    int const needRecreate = ( m_workVectors.size() != numVectors || m_workVectorsLocalSize != src.localSize() ) ? 1 : 0;
+    if( MpiWrapper::Max( needRecreate, getComm( src ) ) > 0 )
+    {
+      m_workVectors.resize( numVectors );
+      for( localIndex i = 0; i < numVectors; ++i )
+      {
+        m_workVectors[i] = createTempVector( src );
+      }
+      m_workVectorsLocalSize = src.localSize();
+    }
+  }
+
   /**
    * @brief Output iteration progress (called by implementations).
    * @param iter  current iteration number
@@ -230,8 +322,14 @@ protected:
   /// results of a solve
   mutable LinearSolverResult m_result;
 
-  /// Absolute residual norms at each iteration (if available)
+  /// Absolute residual norms at each iteration of the last solve (if available)
   mutable array1d< real64 > m_residualNorms;
+
+  /// Work vectors kept between solves (see prepareWorkVectors())
+  mutable array1d< VectorTemp > m_workVectors;
+
+  /// Local size of the vectors stored in m_workVectors
+  mutable localIndex m_workVectorsLocalSize;
 };
 
 } //namespace geosx
@@ -57,6 +57,20 @@ LinearSolverParameters params_GMRES()
   return parameters;
 }
 
+LinearSolverParameters params_PipelinedCG()
+{
+  LinearSolverParameters parameters = params_CG();
+  parameters.krylov.usePipelined = true;
+  return parameters;
+}
+
+LinearSolverParameters params_GMRES_CGS2()
+{
+  LinearSolverParameters parameters = params_GMRES();
+  parameters.krylov.orthogonalization = LinearSolverParameters::Orthogonalization::cgs2;
+  return parameters;
+}
+
 template< typename OPERATOR, typename PRECOND, typename VECTOR >
 class KrylovSolverTestBase : public ::testing::Test
 {
@@ -84,20 +98,26 @@ protected:
 
   void test( LinearSolverParameters const & params )
   {
-    sol_true.rand();
-    sol_comp.zero();
-    matrix.apply( sol_true, rhs_true );
-
-    // Create the solver and solve the system
+    // Create the solver
     using Vector = typename OPERATOR::Vector;
     std::unique_ptr< KrylovSolver< Vector > > const solver = KrylovSolver< Vector >::Create( params, matrix, precond );
-    solver->solve( rhs_true, sol_comp );
-    EXPECT_TRUE( solver->result().success() );
 
-    // Check that solution is within epsilon of true
-    sol_comp.axpy( -1.0, sol_true );
-    real64 const relTol = cond_est * params.krylov.relTolerance;
-    EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), relTol );
+    // Solve the system twice with the same solver object, the second solve reusing work vectors
+    for( integer solveIndex = 0; solveIndex < 2; ++solveIndex )
+    {
+      sol_true.rand();
+      sol_comp.zero();
+      matrix.apply( sol_true, rhs_true );
+
+      solver->solve( rhs_true, sol_comp );
+      EXPECT_TRUE( solver->result().success() );
+      EXPECT_EQ( solver->history().size(), solver->result().numIterations + 1 );
+
+      // Check that solution is within epsilon of true
+      sol_comp.axpy( -1.0, sol_true );
+      real64 const relTol = cond_est * params.krylov.relTolerance;
+      EXPECT_LT( sol_comp.norm2() / sol_true.norm2(), relTol );
+    }
   }
 };
 
@@ -155,10 +175,22 @@ TYPED_TEST_P( KrylovSolverTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverTest, GMRES_CGS2 )
+{
+  this->test( params_GMRES_CGS2() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipelinedCG,
+                             GMRES_CGS2 );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverTest, TrilinosInterface, );
@@ -245,10 +277,22 @@ TYPED_TEST_P( KrylovSolverBlockTest, GMRES )
   this->test( params_GMRES() );
 }
 
+TYPED_TEST_P( KrylovSolverBlockTest, PipelinedCG )
+{
+  this->test( params_PipelinedCG() );
+}
+
+TYPED_TEST_P( KrylovSolverBlockTest, GMRES_CGS2 )
+{
+  this->test( params_GMRES_CGS2() );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( KrylovSolverBlockTest,
                              CG,
                              BiCGSTAB,
-                             GMRES );
+                             GMRES,
+                             PipelinedCG,
+                             GMRES_CGS2 );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, KrylovSolverBlockTest, TrilinosInterface, );
@@ -485,10 +485,75 @@ TYPED_TEST_P( LAOperationsTest, RectangularMatrixOperations )
   EXPECT_DOUBLE_EQ( c, std::sqrt( static_cast< real64 >( nRows * ( nRows + 1 ) * ( 2 * nRows + 1 ) ) / 3.0 ) );
 }
 
+TYPED_TEST_P( LAOperationsTest, MatrixUpdateValues )
+{
+  using Matrix = typename TypeParam::ParallelMatrix;
+
+  int const rank = MpiWrapper::Comm_rank( MPI_COMM_GEOSX );
+  int const nproc = MpiWrapper::Comm_size( MPI_COMM_GEOSX );
+
+  // Local part of a 1D Laplace operator, 10 rows per rank
+  localIndex const nLocal = 10;
+  globalIndex const nGlobal = nLocal * nproc;
+  globalIndex const rankOffset = nLocal * rank;
+
+  auto const buildLocalMatrix = [&]( real64 const scale, bool const extraEntry )
+  {
+    SparsityPattern< globalIndex > pattern( nLocal, nGlobal, 4 );
+    for( localIndex i = 0; i < nLocal; ++i )
+    {
+      globalIndex const row = rankOffset + i;
+      for( globalIndex col = std::max( row - 1, globalIndex( 0 ) ); col <= std::min( row + 1, nGlobal - 1 ); ++col )
+      {
+        pattern.insertNonZero( i, col );
+      }
+    }
+    if( extraEntry )
+    {
+      pattern.insertNonZero( 0, rankOffset + 2 );
+    }
+
+    CRSMatrix< real64, globalIndex > localMatrix;
+    localMatrix.assimilate< serialPolicy >( std::move( pattern ) );
+    for( localIndex i = 0; i < nLocal; ++i )
+    {
+      arraySlice1d< globalIndex const > const cols = localMatrix.getColumns( i );
+      arraySlice1d< real64 > const vals = localMatrix.getEntries( i );
+      for( localIndex k = 0; k < cols.size(); ++k )
+      {
+        vals[k] = scale * ( cols[k] == rankOffset + i ? 2.0 : -1.0 );
+      }
+    }
+    return localMatrix;
+  };
+
+  Matrix A;
+  CRSMatrix< real64, globalIndex > localMatrix = buildLocalMatrix( 1.0, false );
+  EXPECT_FALSE( A.updateValues( localMatrix.toViewConst(), MPI_COMM_GEOSX ) );
+  EXPECT_DOUBLE_EQ( A.normInf(), 4.0 );
+
+  // Same sparsity: structure is reused and values are refreshed
+  localMatrix = buildLocalMatrix( 3.0, false );
+  EXPECT_TRUE( A.updateValues( localMatrix.toViewConst(), MPI_COMM_GEOSX ) );
+  EXPECT_DOUBLE_EQ( A.normInf(), 12.0 );
+  EXPECT_EQ( A.numGlobalNonzeros(), 3 * nGlobal - 2 );
+
+  // Modified sparsity: matrix must be recreated
+  localMatrix = buildLocalMatrix( 1.0, true );
+  EXPECT_FALSE( A.updateValues( localMatrix.toViewConst(), MPI_COMM_GEOSX ) );
+  EXPECT_EQ( A.numGlobalNonzeros(), 3 * nGlobal - 2 + nproc );
+
+  // Sparsity modified on one rank only: all ranks must recreate together
+  localMatrix = buildLocalMatrix( 1.0, rank == 0 );
+  EXPECT_FALSE( A.updateValues( localMatrix.toViewConst(), MPI_COMM_GEOSX ) );
+  EXPECT_EQ( A.numGlobalNonzeros(), 3 * nGlobal - 2 + 1 );
+}
+
 REGISTER_TYPED_TEST_SUITE_P( LAOperationsTest,
                              VectorFunctions,
                              MatrixMatrixOperations,
-                             RectangularMatrixOperations );
+                             RectangularMatrixOperations,
+                             MatrixUpdateValues );
 
 #ifdef GEOSX_USE_TRILINOS
 INSTANTIATE_TYPED_TEST_SUITE_P( Trilinos, LAOperationsTest, TrilinosInterface, );
@@ -63,6 +63,26 @@ struct LinearSolverParameters
     block   ///< Block preconditioner
   };
 
+  /**
+   * @brief Preconditioner setup reuse (lagging) policy.
+   */
+  enum class PreconditionerReuse : integer
+  {
+    never,    ///< Recompute preconditioner for every linear solve
+    fixed,    ///< Reuse preconditioner for a fixed number of linear solves
+    adaptive, ///< Reuse preconditioner until Krylov iteration count grows too much
+    timeStep  ///< Recompute preconditioner only when a new time step (or time step cut) starts
+  };
+
+  /**
+   * @brief Orthogonalization scheme of the Krylov basis.
+   */
+  enum class Orthogonalization : integer
+  {
+    mgs,  ///< Modified Gram-Schmidt (one global reduction per basis vector)
+    cgs2  ///< Classical Gram-Schmidt with reorthogonalization (two global reductions per iteration)
+  };
+
   integer logLevel = 0;     ///< Output level [0=none, 1=basic, 2=everything]
   integer dofsPerNode = 1;  ///< Dofs per node (or support location) for non-scalar problems
   bool isSymmetric = false; ///< Whether input matrix is symmetric (may affect choice of scheme)
@@ -78,9 +98,22 @@ struct LinearSolverParameters
     integer maxRestart = 200;         ///< Max number of vectors in Krylov basis before restarting
     integer useAdaptiveTol = false;   ///< Use Eisenstat-Walker adaptive tolerance
     real64 weakestTol = 1e-3;         ///< Weakest allowed tolerance when using adaptive method
+    Orthogonalization orthogonalization = Orthogonalization::mgs; ///< Orthogonalization scheme (native GMRES)
+    integer usePipelined = false;     ///< Use the pipelined variant of the method (native CG)
   }
   krylov;                             ///< Krylov-method parameter struct
 
+  /// Preconditioner reuse parameters
+  struct Reuse
+  {
+    PreconditionerReuse policy = PreconditionerReuse::never; ///< Reuse policy
+    integer maxReuse = 5;           ///< Max number of consecutive solves reusing a setup (fixed policy; upper bound
+                                    ///< for other policies if positive)
+    real64 iterationGrowth = 0.5;   ///< Relative growth of Krylov iterations (w.r.t. the first solve after setup)
+                                    ///< that triggers recomputation (adaptive policy)
+  }
+  reuse;                            ///< Preconditioner reuse parameter struct
+
   /// Matrix-scaling parameters
   struct Scaling
   {
@@ -151,6 +184,16 @@ ENUM_STRINGS( LinearSolverParameters::PreconditionerType,
               "mgr",
               "block" )
 
+ENUM_STRINGS( LinearSolverParameters::Orthogonalization,
+              "mgs",
+              "cgs2" )
+
+ENUM_STRINGS( LinearSolverParameters::PreconditionerReuse,
+              "never",
+              "fixed",
+              "adaptive",
+              "timeStep" )
+
 } /* namespace geosx */
 
 #endif /*GEOSX_LINEARALGEBRA_UTILITIES_LINEARSOLVERPARAMETERS_HPP_ */
@@ -256,6 +256,7 @@ void DomainPartition::SetupCommunications( bool use_nonblocking )
                                                            m_neighbors );
 
   CommunicationTools::FindGhosts( meshLevel, m_neighbors, use_nonblocking );
+  meshLevel.incrementTopologyEpoch();
 
   faceManager->SortAllFaceNodes( nodeManager, meshLevel.getElemManager() );
   faceManager->computeGeometry( nodeManager );
@@ -131,12 +131,13 @@ protected:
   /**
    * @brief Method to apply an function with an arbitrary type of output
    * @tparam LEAF the return type
+   * @tparam POLICY the execution policy of the evaluation loop (host policies only)
    * @param[in] group a pointer to the object holding the function arguments
    * @param[in] time current time
    * @param[in] set the subset of nodes to apply the function to
    * @param[out] result the results
    */
-  template< typename LEAF >
+  template< typename LEAF, typename POLICY = serialPolicy >
   void EvaluateT( dataRepository::Group const * const group,
                   real64 const time,
                   SortedArrayView< localIndex const > const & set,
@@ -146,7 +147,7 @@ protected:
 
 };
 
-template< typename LEAF >
+template< typename LEAF, typename POLICY >
 void FunctionBase::EvaluateT( dataRepository::Group const * const group,
                               real64 const time,
                               SortedArrayView< localIndex const > const & set,
@@ -190,7 +191,7 @@ void FunctionBase::EvaluateT( dataRepository::Group const * const group,
   GEOSX_ERROR_IF( result.size() != set.size(), "To apply a function to a set, the size of the result and set must match" );
 
 
-  forAll< serialPolicy >( set.size(), [&, set]( localIndex const i )
+  forAll< POLICY >( set.size(), [&, set]( localIndex const i )
   {
     localIndex const index = set[ i ];
     double input[4];
@@ -68,7 +68,7 @@ public:
                         SortedArrayView< localIndex const > const & set,
                         real64_array & result ) const override final
   {
-    FunctionBase::EvaluateT< SymbolicFunction >( group, time, set, result );
+    FunctionBase::EvaluateT< SymbolicFunction, parallelHostPolicy >( group, time, set, result );
   }
 
   /**
@@ -86,6 +86,15 @@ public:
 #endif
   }
 
+  /**
+   * @brief Evaluate the expression at a batch of points
+   * @tparam POLICY the execution policy of the evaluation loop (host policies only)
+   * @param[in] inputs the values of each variable, of size (number of variables) x (number of points)
+   * @param[out] outputs the expression values at each point
+   */
+  template< typename POLICY >
+  void EvaluateBatch( arrayView2d< real64 const > const & inputs,
+                      arrayView1d< real64 > const & outputs ) const;
 
   /**
    * @brief Set the symbolic variable names
@@ -115,8 +124,39 @@ private:
   /// Symbolic expression
   string m_expression;
 
+  /// Maximum number of variables in a batch evaluation
+  static localIndex constexpr m_maxNumVariables = 16;
+
 };
 
+template< typename POLICY >
+void SymbolicFunction::EvaluateBatch( arrayView2d< real64 const > const & inputs,
+                                      arrayView1d< real64 > const & outputs ) const
+{
+#ifdef GEOSX_USE_MATHPRESSO
+  localIndex const numVariables = inputs.size( 0 );
+  GEOSX_ERROR_IF_NE_MSG( numVariables, m_variableNames.size(), "Number of inputs does not match the number of variables" );
+  GEOSX_ERROR_IF( numVariables > m_maxNumVariables, "Number of variables exceeds the maximum: " << numVariables );
+  GEOSX_ERROR_IF_NE_MSG( inputs.size( 1 ), outputs.size(), "Number of evaluation points and outputs must match" );
+
+  // The expression is compiled once in InitializeFunction, and the compiled code is safe to call concurrently
+  mathpresso::Expression const & expression = parserExpression;
+  forAll< POLICY >( outputs.size(), [=, &expression]( localIndex const i )
+  {
+    // Gather the variables of this point in the layout expected by the compiled expression
+    real64 point[m_maxNumVariables];
+    for( localIndex v=0; v<numVariables; ++v )
+    {
+      point[v] = inputs[v][i];
+    }
+    outputs[i] = expression.evaluate( point );
+  } );
+#else
+  GEOSX_UNUSED_VAR( inputs, outputs );
+  GEOSX_ERROR( "GEOSX was not built with mathpresso!" );
+#endif
+}
+
 
 } /* namespace geosx */
 
@@ -18,7 +18,6 @@
 
 #include "TableFunction.hpp"
 #include "common/DataTypes.hpp"
-#include <algorithm>
 
 namespace geosx
 {
@@ -52,8 +51,10 @@ TableFunction::TableFunction( const std::string & name,
   m_dimensions( 0 ),
   m_size(),
   m_indexIncrement(),
-  m_corners(),
-  m_numCorners( 0 )
+  m_packedCoordinates(),
+  m_coordinateOffsets(),
+  m_axisInvSpacing(),
+  m_kernelWrapper( createKernelWrapper() )
 {
   registerWrapper( keys::tableCoordinates, &m_tableCoordinates1D )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -155,6 +156,8 @@ void TableFunction::reInitializeFunction()
   m_dimensions = LvArray::integerConversion< localIndex >( m_coordinates.size());
   m_size.resize( m_dimensions );
 
+  GEOSX_ERROR_IF( m_dimensions > m_maxDimensions, "Table function dimension exceeds the maximum: " << m_dimensions );
+
   // Setup index increment (assume data is in Fortran array order)
   localIndex increment = 1;
   m_indexIncrement.resize( m_dimensions );
@@ -168,138 +171,49 @@ void TableFunction::reInitializeFunction()
   // Error checking
   GEOSX_ERROR_IF( increment != m_values.size(), "Table dimensions do not match!" );
 
-  // Build a quick map to help with linear interpolation
-  m_numCorners = static_cast< localIndex >(pow( 2, m_dimensions ));
-  for( localIndex ii=0; ii<m_numCorners; ++ii )
-  {
-    for( localIndex jj=0; jj<m_dimensions; ++jj )
-    {
-      m_corners[jj][ii] = int(ii / pow( 2, jj )) % 2;
-    }
-  }
-}
-
-
-real64 TableFunction::Evaluate( real64 const * const input ) const
-{
-  real64 result = 0.0;
-
-  // Linear interpolation
-  if( m_interpolationMethod == InterpolationType::Linear )
+  // Pack the axes contiguously and detect evenly spaced axes, which are indexed in constant time
+  m_packedCoordinates.clear();
+  m_coordinateOffsets.resize( m_dimensions );
+  m_axisInvSpacing.resize( m_dimensions );
+  for( localIndex ii=0; ii<m_dimensions; ++ii )
   {
-    localIndex bounds[m_maxDimensions][2];
-    real64 weights[m_maxDimensions][2];
+    real64_array const & axis = m_coordinates[ii];
+    localIndex const axisSize = m_size[ii];
 
-    // Determine position, weights
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
+    m_coordinateOffsets[ii] = m_packedCoordinates.size();
+    for( localIndex jj=0; jj<axisSize; ++jj )
     {
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of this axis
-        bounds[ii][0] = 0;
-        bounds[ii][1] = 0;
-        weights[ii][0] = 0;
-        weights[ii][1] = 1;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of this axis
-        bounds[ii][0] = m_size[ii] - 1;
-        bounds[ii][1] = bounds[ii][0];
-        weights[ii][0] = 1;
-        weights[ii][1] = 0;
-      }
-      else
-      {
-        // Find the coordinate index
-        ///TODO make this fast
-        // Note: lower_bound uses a binary search...  If we assume coordinates are
-        // evenly spaced, we can speed things up considerably
-        auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
-        bounds[ii][1] = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
-        bounds[ii][0] = bounds[ii][1] - 1;
-
-        real64 dx = m_coordinates[ii][bounds[ii][1]] - m_coordinates[ii][bounds[ii][0]];
-        weights[ii][0] = 1.0 - (input[ii] - m_coordinates[ii][bounds[ii][0]]) / dx;
-        weights[ii][1] = 1.0 - weights[ii][0];
-      }
+      m_packedCoordinates.emplace_back( axis[jj] );
     }
 
-    // Calculate the result
-    for( localIndex ii=0; ii<m_numCorners; ++ii )
+    m_axisInvSpacing[ii] = 0.0;
+    if( axisSize > 1 )
     {
-      // Find array index
-      localIndex tableIndex = 0;
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
+      real64 const spacing = ( axis[axisSize - 1] - axis[0] ) / ( axisSize - 1 );
+      bool isUniform = spacing > 0.0;
+      for( localIndex jj=1; jj<axisSize && isUniform; ++jj )
       {
-        tableIndex += bounds[jj][m_corners[jj][ii]] * m_indexIncrement[jj];
+        isUniform = std::fabs( axis[jj] - ( axis[0] + jj * spacing ) ) <= 1e-6 * spacing;
       }
-
-      // Determine weighted value
-      real64 cornerValue = m_values[tableIndex];
-      for( localIndex jj=0; jj<m_dimensions; ++jj )
+      if( isUniform )
       {
-        cornerValue *= weights[jj][m_corners[jj][ii]];
+        m_axisInvSpacing[ii] = 1.0 / spacing;
       }
-      result += cornerValue;
     }
   }
-  // Nearest, Upper, Lower interpolation methods
-  else
-  {
-    // Determine the index to the nearest table entry
-    localIndex tableIndex = 0;
-    for( localIndex ii=0; ii<m_dimensions; ++ii )
-    {
-      // Determine the index along each table axis
-      localIndex subIndex = 0;
 
-      if( input[ii] <= m_coordinates[ii][0] )
-      {
-        // Coordinate is to the left of the table axis
-        subIndex = 0;
-      }
-      else if( input[ii] >= m_coordinates[ii][m_size[ii] - 1] )
-      {
-        // Coordinate is to the right of the table axis
-        subIndex = m_size[ii] - 1;
-      }
-      else
-      {
-        // Coordinate is within the table axis
-        // Note: std::distance will return the index of the upper table vertex
-        auto lower = std::lower_bound( m_coordinates[ii].begin(), m_coordinates[ii].end(), input[ii] );
-        subIndex = LvArray::integerConversion< localIndex >( std::distance( m_coordinates[ii].begin(), lower ));
-
-        // Interpolation types:
-        //   - Nearest returns the value of the closest table vertex
-        //   - Upper returns the value of the next table vertex
-        //   - Lower returns the value of the previous table vertex
-        if( m_interpolationMethod == InterpolationType::Nearest )
-        {
-          if((input[ii] - m_coordinates[ii][subIndex - 1]) <= (m_coordinates[ii][subIndex] - input[ii]))
-          {
-            --subIndex;
-          }
-        }
-        else if( m_interpolationMethod == InterpolationType::Lower )
-        {
-          if( subIndex > 0 )
-          {
-            --subIndex;
-          }
-        }
-      }
-
-      // Increment the global table index
-      tableIndex += subIndex * m_indexIncrement[ii];
-    }
-
-    // Retrieve the nearest value
-    result = m_values[tableIndex];
-  }
+  m_kernelWrapper = createKernelWrapper();
+}
 
-  return result;
+TableFunction::KernelWrapper TableFunction::createKernelWrapper() const
+{
+  return KernelWrapper( m_interpolationMethod,
+                        m_packedCoordinates.toViewConst(),
+                        m_coordinateOffsets.toViewConst(),
+                        m_size.toViewConst(),
+                        m_indexIncrement.toViewConst(),
+                        m_axisInvSpacing.toViewConst(),
+                        m_values.toViewConst() );
 }
 
 REGISTER_CATALOG_ENTRY( FunctionBase, TableFunction, std::string const &, Group * const )
@@ -85,7 +85,7 @@ public:
                          SortedArrayView< localIndex const > const & set,
                          real64_array & result ) const override final
   {
-    FunctionBase::EvaluateT< TableFunction >( group, time, set, result );
+    FunctionBase::EvaluateT< TableFunction, parallelHostPolicy >( group, time, set, result );
   }
 
   /**
@@ -93,7 +93,20 @@ public:
    * @param input a scalar input
    * @return the function result
    */
-  virtual real64 Evaluate( real64 const * const input ) const override final;
+  virtual real64 Evaluate( real64 const * const input ) const override final
+  {
+    return m_kernelWrapper.compute( input );
+  }
+
+  /**
+   * @brief Evaluate the table at a batch of points
+   * @tparam POLICY the execution policy of the evaluation loop
+   * @param[in] inputs the evaluation points, of size (number of points) x (number of table dimensions)
+   * @param[out] outputs the table values at the evaluation points
+   */
+  template< typename POLICY >
+  void EvaluateBatch( arrayView2d< real64 const > const & inputs,
+                      arrayView1d< real64 > const & outputs ) const;
 
   /**
    * @brief Get the table axes definitions
@@ -130,20 +143,109 @@ public:
    * @brief Set the interpolation method
    * @param method The interpolation method
    */
-  void setInterpolationMethod( InterpolationType const method ) { m_interpolationMethod = method; }
+  void setInterpolationMethod( InterpolationType const method )
+  {
+    m_interpolationMethod = method;
+    m_kernelWrapper = createKernelWrapper();
+  }
 
   /**
    * @brief Set the table coordinates
    * @param coordinates An array of arrays containing table coordinate definitions
+   * @note reInitializeFunction() must be called before the table is evaluated again
    */
   void setTableCoordinates( array1d< real64_array > coordinates ) { m_coordinates = coordinates; }
 
   /**
    * @brief Set the table values
    * @param values An array of table values in fortran order
+   * @note reInitializeFunction() must be called before the table is evaluated again
    */
   void setTableValues( real64_array values ) { m_values = values; }
 
+  /**
+   * @class KernelWrapper
+   *
+   * A lightweight, copyable view of the table that can be evaluated in host and device kernels
+   */
+  class KernelWrapper
+  {
+public:
+
+    /**
+     * @brief Constructor
+     * @param[in] interpolationMethod the table interpolation method
+     * @param[in] coordinates the coordinates of all table axes, stored contiguously
+     * @param[in] coordinateOffsets the offset of each axis in @p coordinates
+     * @param[in] size the number of coordinates along each axis
+     * @param[in] indexIncrement the stride of each axis in @p values
+     * @param[in] axisInvSpacing the inverse of the coordinate spacing of each axis (zero if the axis is not uniform)
+     * @param[in] values the table values (in fortran order)
+     */
+    KernelWrapper( InterpolationType const interpolationMethod,
+                   arrayView1d< real64 const > const & coordinates,
+                   arrayView1d< localIndex const > const & coordinateOffsets,
+                   arrayView1d< localIndex const > const & size,
+                   arrayView1d< localIndex const > const & indexIncrement,
+                   arrayView1d< real64 const > const & axisInvSpacing,
+                   arrayView1d< real64 const > const & values ):
+      m_interpolationMethod( interpolationMethod ),
+      m_coordinates( coordinates ),
+      m_coordinateOffsets( coordinateOffsets ),
+      m_size( size ),
+      m_indexIncrement( indexIncrement ),
+      m_axisInvSpacing( axisInvSpacing ),
+      m_values( values )
+    {}
+
+    /**
+     * @brief Interpolate in the table
+     * @param[in] input the coordinates of the evaluation point
+     * @return the interpolated value
+     */
+    GEOSX_HOST_DEVICE
+    real64 compute( real64 const * const input ) const;
+
+private:
+
+    /**
+     * @brief Find the index of the first coordinate that is not less than a value along an axis
+     * @param[in] dim the axis index
+     * @param[in] value the value, strictly between the first and the last coordinates of the axis
+     * @return the index of the upper bound of the interval containing @p value
+     */
+    GEOSX_HOST_DEVICE
+    localIndex findUpperIndex( localIndex const dim, real64 const value ) const;
+
+    /// Table interpolation method
+    InterpolationType m_interpolationMethod;
+
+    /// Coordinates of all table axes, stored contiguously
+    arrayView1d< real64 const > m_coordinates;
+
+    /// Offset of each axis in m_coordinates
+    arrayView1d< localIndex const > m_coordinateOffsets;
+
+    /// Number of coordinates along each axis
+    arrayView1d< localIndex const > m_size;
+
+    /// Stride of each axis in m_values
+    arrayView1d< localIndex const > m_indexIncrement;
+
+    /// Inverse coordinate spacing of each evenly spaced axis (zero for other axes)
+    arrayView1d< real64 const > m_axisInvSpacing;
+
+    /// Table values (in fortran order)
+    arrayView1d< real64 const > m_values;
+  };
+
+  /**
+   * @brief Create a kernel wrapper for the table
+   * @return the kernel wrapper
+   * @note The wrapper is only valid until the next call to reInitializeFunction()
+   */
+  KernelWrapper createKernelWrapper() const;
+
 private:
   /// Coordinates for 1D table
   real64_array m_tableCoordinates1D;
@@ -175,16 +277,199 @@ private:
   /// Array used to locate values within ND tables
   localIndex_array m_indexIncrement;
 
-  /**
-   * @brief The corners of the box that surround the value in N dimensions
-   * m_corners should be of size m_maxDimensions x (2^m_maxDimensions)
-   */
-  localIndex m_corners[m_maxDimensions][16];
+  /// Coordinates of all table axes, stored contiguously for the kernel wrapper
+  real64_array m_packedCoordinates;
 
-  /// The number of active table corners
-  localIndex m_numCorners;
+  /// Offset of each axis in m_packedCoordinates
+  localIndex_array m_coordinateOffsets;
+
+  /// Inverse coordinate spacing of each evenly spaced axis (zero for other axes)
+  real64_array m_axisInvSpacing;
+
+  /// Kernel wrapper used for pointwise evaluation
+  KernelWrapper m_kernelWrapper;
 };
 
+GEOSX_HOST_DEVICE
+inline
+localIndex TableFunction::KernelWrapper::findUpperIndex( localIndex const dim, real64 const value ) const
+{
+  real64 const * const axis = m_coordinates.data() + m_coordinateOffsets[dim];
+  localIndex const axisSize = m_size[dim];
+
+  if( m_axisInvSpacing[dim] > 0.0 )
+  {
+    // Evenly spaced axis: compute the interval directly, then correct for round-off
+    localIndex upper = static_cast< localIndex >( ceil( ( value - axis[0] ) * m_axisInvSpacing[dim] ) );
+    upper = ( upper < 1 ) ? 1 : ( ( upper > axisSize - 1 ) ? axisSize - 1 : upper );
+    while( axis[upper - 1] >= value )
+    {
+      --upper;
+    }
+    while( axis[upper] < value )
+    {
+      ++upper;
+    }
+    return upper;
+  }
+
+  // Otherwise, binary search with the invariant axis[lower] < value <= axis[upper]
+  localIndex lower = 0;
+  localIndex upper = axisSize - 1;
+  while( upper - lower > 1 )
+  {
+    localIndex const mid = ( lower + upper ) / 2;
+    if( axis[mid] < value )
+    {
+      lower = mid;
+    }
+    else
+    {
+      upper = mid;
+    }
+  }
+  return upper;
+}
+
+GEOSX_HOST_DEVICE
+inline
+real64 TableFunction::KernelWrapper::compute( real64 const * const input ) const
+{
+  localIndex const numDimensions = m_size.size();
+  real64 result = 0.0;
+
+  // Linear interpolation
+  if( m_interpolationMethod == InterpolationType::Linear )
+  {
+    localIndex bounds[m_maxDimensions][2];
+    real64 weights[m_maxDimensions][2];
+
+    // Determine position, weights
+    for( localIndex ii=0; ii<numDimensions; ++ii )
+    {
+      real64 const * const axis = m_coordinates.data() + m_coordinateOffsets[ii];
+
+      if( input[ii] <= axis[0] )
+      {
+        // Coordinate is to the left of this axis
+        bounds[ii][0] = 0;
+        bounds[ii][1] = 0;
+        weights[ii][0] = 0;
+        weights[ii][1] = 1;
+      }
+      else if( input[ii] >= axis[m_size[ii] - 1] )
+      {
+        // Coordinate is to the right of this axis
+        bounds[ii][0] = m_size[ii] - 1;
+        bounds[ii][1] = bounds[ii][0];
+        weights[ii][0] = 1;
+        weights[ii][1] = 0;
+      }
+      else
+      {
+        // Find the coordinate index
+        bounds[ii][1] = findUpperIndex( ii, input[ii] );
+        bounds[ii][0] = bounds[ii][1] - 1;
+
+        real64 dx = axis[bounds[ii][1]] - axis[bounds[ii][0]];
+        weights[ii][0] = 1.0 - (input[ii] - axis[bounds[ii][0]]) / dx;
+        weights[ii][1] = 1.0 - weights[ii][0];
+      }
+    }
+
+    // Calculate the result; bit jj of the corner index selects the bound along axis jj
+    localIndex const numCorners = localIndex( 1 ) << numDimensions;
+    for( localIndex ii=0; ii<numCorners; ++ii )
+    {
+      // Find array index
+      localIndex tableIndex = 0;
+      for( localIndex jj=0; jj<numDimensions; ++jj )
+      {
+        tableIndex += bounds[jj][(ii >> jj) & 1] * m_indexIncrement[jj];
+      }
+
+      // Determine weighted value
+      real64 cornerValue = m_values[tableIndex];
+      for( localIndex jj=0; jj<numDimensions; ++jj )
+      {
+        cornerValue *= weights[jj][(ii >> jj) & 1];
+      }
+      result += cornerValue;
+    }
+  }
+  // Nearest, Upper, Lower interpolation methods
+  else
+  {
+    // Determine the index to the nearest table entry
+    localIndex tableIndex = 0;
+    for( localIndex ii=0; ii<numDimensions; ++ii )
+    {
+      real64 const * const axis = m_coordinates.data() + m_coordinateOffsets[ii];
+
+      // Determine the index along each table axis
+      localIndex subIndex = 0;
+
+      if( input[ii] <= axis[0] )
+      {
+        // Coordinate is to the left of the table axis
+        subIndex = 0;
+      }
+      else if( input[ii] >= axis[m_size[ii] - 1] )
+      {
+        // Coordinate is to the right of the table axis
+        subIndex = m_size[ii] - 1;
+      }
+      else
+      {
+        // Coordinate is within the table axis
+        // Note: this is the index of the upper table vertex
+        subIndex = findUpperIndex( ii, input[ii] );
+
+        // Interpolation types:
+        //   - Nearest returns the value of the closest table vertex
+        //   - Upper returns the value of the next table vertex
+        //   - Lower returns the value of the previous table vertex
+        if( m_interpolationMethod == InterpolationType::Nearest )
+        {
+          if((input[ii] - axis[subIndex - 1]) <= (axis[subIndex] - input[ii]))
+          {
+            --subIndex;
+          }
+        }
+        else if( m_interpolationMethod == InterpolationType::Lower )
+        {
+          if( subIndex > 0 )
+          {
+            --subIndex;
+          }
+        }
+      }
+
+      // Increment the global table index
+      tableIndex += subIndex * m_indexIncrement[ii];
+    }
+
+    // Retrieve the nearest value
+    result = m_values[tableIndex];
+  }
+
+  return result;
+}
+
+template< typename POLICY >
+void TableFunction::EvaluateBatch( arrayView2d< real64 const > const & inputs,
+                                   arrayView1d< real64 > const & outputs ) const
+{
+  GEOSX_ERROR_IF_NE_MSG( inputs.size( 1 ), m_dimensions, "Number of inputs does not match the table dimensions" );
+  GEOSX_ERROR_IF_NE_MSG( inputs.size( 0 ), outputs.size(), "Number of evaluation points and outputs must match" );
+
+  KernelWrapper const kernelWrapper = createKernelWrapper();
+  forAll< POLICY >( outputs.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+  {
+    outputs[i] = kernelWrapper.compute( &inputs[i][0] );
+  } );
+}
+
 ENUM_STRINGS( TableFunction::InterpolationType, "linear", "nearest", "upper", "lower" )
 
 
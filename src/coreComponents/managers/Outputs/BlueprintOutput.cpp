@@ -108,6 +108,7 @@ void BlueprintOutput::Execute( real64 const time,
                                dataRepository::Group * group )
 {
   GEOSX_MARK_FUNCTION;
+  dataRepository::waitForPendingWriteBeforeHDF5();
 
   DomainPartition const & domain = dynamicCast< DomainPartition const & >( *group );
   MeshLevel const & meshLevel = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
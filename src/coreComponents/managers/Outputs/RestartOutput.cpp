@@ -31,8 +31,38 @@ using namespace dataRepository;
 
 RestartOutput::RestartOutput( std::string const & name,
                               Group * const parent ):
-  OutputBase( name, parent )
-{}
+  OutputBase( name, parent ),
+  m_asynchronous( 0 ),
+  m_fullRestartInterval( 1 ),
+  m_numFiles( 0 ),
+  m_numWrites( 0 ),
+  m_baseRestartName()
+{
+  registerWrapper( viewKeyStruct::asynchronousString, &m_asynchronous )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Write the restart files on a background thread (uses a copy of the restart data)." );
+
+  registerWrapper( viewKeyStruct::fullRestartIntervalString, &m_fullRestartInterval )->
+    setApplyDefaultValue( 1 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Write a full restart every fullRestartInterval restarts, in between only write the data "
+                    "changed since the last full restart (1 - always write full restarts)." );
+
+  registerWrapper( viewKeyStruct::numFilesString, &m_numFiles )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Number of files each restart is aggregated into, groups of consecutive ranks send their data "
+                    "to one rank that writes their file (0 - one file per rank)." );
+}
+
+void RestartOutput::PostProcessInput()
+{
+  GEOSX_ERROR_IF_LT_MSG( m_fullRestartInterval, 1,
+                         "Restart output " << getName() << ": " << viewKeyStruct::fullRestartIntervalString << " must be positive." );
+  GEOSX_ERROR_IF_LT_MSG( m_numFiles, 0,
+                         "Restart output " << getName() << ": " << viewKeyStruct::numFilesString << " must not be negative." );
+}
 
 RestartOutput::~RestartOutput()
 {}
@@ -54,10 +84,30 @@ void RestartOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
   char fileName[200] = {0};
   sprintf( fileName, "%s_%s_%09d", problemManager->getProblemName().c_str(), "restart", cycleNumber );
 
-  problemManager->prepareToWrite();
-  FunctionManager::Instance().prepareToWrite();
-  FieldSpecificationManager::get().prepareToWrite();
-  writeTree( fileName );
+  // every fullRestartInterval writes, take a full restart that later delta restarts refer to
+  RestartWriteMode mode = RestartWriteMode::FULL;
+  if( m_fullRestartInterval > 1 )
+  {
+    mode = ( m_numWrites % m_fullRestartInterval == 0 ) ? RestartWriteMode::BASE : RestartWriteMode::DELTA;
+  }
+  ++m_numWrites;
+
+  problemManager->prepareToWrite( mode );
+  FunctionManager::Instance().prepareToWrite( mode );
+  FieldSpecificationManager::get().prepareToWrite( mode );
+  setRestartBase( mode == RestartWriteMode::DELTA ? m_baseRestartName : string() );
+  if( mode == RestartWriteMode::BASE )
+  {
+    m_baseRestartName = fileName;
+  }
+  if( m_asynchronous )
+  {
+    writeTreeAsync( fileName, m_numFiles );
+  }
+  else
+  {
+    writeTree( fileName, m_numFiles );
+  }
   problemManager->finishWriting();
   FunctionManager::Instance().finishWriting();
   FieldSpecificationManager::get().finishWriting();
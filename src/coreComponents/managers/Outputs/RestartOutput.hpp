@@ -20,6 +20,7 @@
 #define GEOSX_MANAGERS_OUTPUTS_RESTARTOUTPUT_HPP_
 
 #include "OutputBase.hpp"
+#include "dataRepository/ConduitRestart.hpp"
 
 
 namespace geosx
@@ -69,14 +70,39 @@ public:
                         dataRepository::Group * domain ) override
   {
     Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    dataRepository::waitForPendingWrite();
   }
 
   /// @cond DO_NOT_DOCUMENT
   struct viewKeyStruct
   {
     dataRepository::ViewKey writeFEMFaces = { "writeFEMFaces" };
+    static constexpr auto asynchronousString = "asynchronous";
+    static constexpr auto fullRestartIntervalString = "fullRestartInterval";
+    static constexpr auto numFilesString = "numFiles";
   } viewKeys;
   /// @endcond
+
+protected:
+
+  virtual void PostProcessInput() override;
+
+private:
+
+  /// Whether to write the restart files on a background thread
+  integer m_asynchronous;
+
+  /// Number of restart writes from one full restart to the next, the ones in between are delta restarts
+  integer m_fullRestartInterval;
+
+  /// Number of files each restart is split into, 0 for one file per rank
+  integer m_numFiles;
+
+  /// Number of restart files written so far by this run
+  integer m_numWrites;
+
+  /// Name of the last full restart, the base of the following delta restarts
+  string m_baseRestartName;
 };
 
 
@@ -19,6 +19,7 @@
 #include "SiloOutput.hpp"
 
 #include "common/TimingMacros.hpp"
+#include "dataRepository/ConduitRestart.hpp"
 #include "fileIO/silo/SiloFile.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/Functions/FunctionManager.hpp"
@@ -83,6 +84,7 @@ void SiloOutput::Execute( real64 const time_n,
                           Group * domain )
 {
   GEOSX_MARK_FUNCTION;
+  dataRepository::waitForPendingWriteBeforeHDF5();
 
   DomainPartition * domainPartition = Group::group_cast< DomainPartition * >( domain );
   SiloFile silo;
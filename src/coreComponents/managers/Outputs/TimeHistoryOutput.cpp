@@ -1,4 +1,7 @@
 #include "TimeHistoryOutput.hpp"
+
+#include "dataRepository/ConduitRestart.hpp"
+
 namespace geosx
 {
 TimeHistoryOutput::TimeHistoryOutput( string const & name,
@@ -103,6 +106,7 @@ void TimeHistoryOutput::Execute( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                  dataRepository::Group * GEOSX_UNUSED_PARAM( domain ) )
 {
   GEOSX_MARK_FUNCTION;
+  dataRepository::waitForPendingWriteBeforeHDF5();
   localIndex newBuffered = m_io.front()->getBufferedCount( );
   for( auto & th_io : m_io )
   {
@@ -30,6 +30,8 @@ VTKOutput::VTKOutput( std::string const & name,
   m_plotFileRoot(),
   m_writeFaceMesh(),
   m_plotLevel(),
+  m_compressor( vtk::VTKCompressor::NONE ),
+  m_asynchronous( 0 ),
   m_writer( name )
 {
   registerWrapper( viewKeysStruct::plotFileRoot, &m_plotFileRoot )->
@@ -50,6 +52,16 @@ VTKOutput::VTKOutput( std::string const & name,
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Output the data in binary format" );
 
+  registerWrapper( viewKeysStruct::compressorString, &m_compressor )->
+    setApplyDefaultValue( m_compressor )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Compression of the binary data. Valid options:\n* " + EnumStrings< vtk::VTKCompressor >::concat( "\n* " ) );
+
+  registerWrapper( viewKeysStruct::asynchronousString, &m_asynchronous )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Write the vtu files on a background thread (uses a copy of the output data)." );
+
 }
 
 VTKOutput::~VTKOutput()
@@ -73,6 +85,8 @@ void VTKOutput::Execute( real64 const time_n,
   {
     m_writer.SetOutputMode( vtk::VTKOutputMode::ASCII );
   }
+  m_writer.SetCompressor( m_compressor );
+  m_writer.SetAsynchronous( m_asynchronous );
   m_writer.SetPlotLevel( m_plotLevel );
   m_writer.Write( time_n, cycleNumber, *domainPartition );
 }
@@ -69,6 +69,7 @@ public:
                         dataRepository::Group * domain ) override
   {
     Execute( time_n, 0, cycleNumber, eventCounter, eventProgress, domain );
+    m_writer.WaitForPendingWrite();
   }
 
   /// @cond DO_NOT_DOCUMENT
@@ -78,6 +79,8 @@ public:
     static constexpr auto writeFEMFaces = "writeFEMFaces";
     static constexpr auto plotLevel = "plotLevel";
     static constexpr auto binaryString = "writeBinaryData";
+    static constexpr auto compressorString = "compressor";
+    static constexpr auto asynchronousString = "asynchronous";
 
   } vtkOutputViewKeys;
   /// @endcond
@@ -89,6 +92,10 @@ private:
 
   integer m_writeBinaryData;
 
+  vtk::VTKCompressor m_compressor;
+
+  integer m_asynchronous;
+
   vtk::VTKPolyDataWriterInterface m_writer;
 
 };
@@ -222,6 +222,95 @@ TEST( FunctionTests, 2DTable )
 }
 
 
+TEST( FunctionTests, 2DTable_uniformBatch )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+
+  // 2D table with an evenly spaced x-axis and an irregular y-axis
+  // f(x, y) = 2*x - 3*y + 5
+  localIndex Ndim = 2;
+  localIndex Nx = 11;
+  localIndex Ny = 4;
+  localIndex Ntest = 100;
+
+  // Setup table
+  array1d< real64_array > coordinates;
+  coordinates.resize( Ndim );
+  coordinates[0].resize( Nx );
+  for( localIndex ii=0; ii<Nx; ++ii )
+  {
+    coordinates[0][ii] = -1.0 + 0.3 * ii;
+  }
+  coordinates[1].resize( Ny );
+  coordinates[1][0] = -1.0;
+  coordinates[1][1] = 0.0;
+  coordinates[1][2] = 0.5;
+  coordinates[1][3] = 2.0;
+
+  real64_array values( Nx * Ny );
+  localIndex tablePosition = 0;
+  for( localIndex jj=0; jj<Ny; ++jj )
+  {
+    for( localIndex ii=0; ii<Nx; ++ii )
+    {
+      real64 x = coordinates[0][ii];
+      real64 y = coordinates[1][jj];
+      values[tablePosition] = (2.0*x) - (3.0*y) + 5.0;
+      ++tablePosition;
+    }
+  }
+
+  TableFunction * table_e = functionManager->CreateChild( "TableFunction", "table_e" )->group_cast< TableFunction * >();
+  table_e->setTableCoordinates( coordinates );
+  table_e->setTableValues( values );
+  table_e->setInterpolationMethod( TableFunction::InterpolationType::Linear );
+  table_e->reInitializeFunction();
+
+  // Build testing inputs, including points outside of the table and on table vertices
+  real64_array2d inputs( Ntest, Ndim );
+  real64_array expected( Ntest );
+  real64_array output( Ntest );
+
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( -1.5, 2.5 );
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    inputs[ii][0] = ( ii % 4 == 0 ) ? coordinates[0][ii % Nx] : distribution( generator );
+    inputs[ii][1] = distribution( generator );
+
+    real64 const x = std::min( std::max( inputs[ii][0], coordinates[0][0] ), coordinates[0][Nx-1] );
+    real64 const y = std::min( std::max( inputs[ii][1], coordinates[1][0] ), coordinates[1][Ny-1] );
+    expected[ii] = (2.0*x) - (3.0*y) + 5.0;
+  }
+
+  // Evaluate the linear interpolation at all points at once
+  table_e->EvaluateBatch< serialPolicy >( inputs.toViewConst(), output.toView() );
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    ASSERT_NEAR( expected[ii], output[ii], 1e-10 );
+  }
+
+  // The batch and pointwise evaluations should match for every interpolation method
+  TableFunction::InterpolationType const methods[] = { TableFunction::InterpolationType::Nearest,
+                                                       TableFunction::InterpolationType::Upper,
+                                                       TableFunction::InterpolationType::Lower };
+  for( TableFunction::InterpolationType const method : methods )
+  {
+    table_e->setInterpolationMethod( method );
+    table_e->EvaluateBatch< parallelHostPolicy >( inputs.toViewConst(), output.toView() );
+    for( localIndex ii=0; ii<Ntest; ++ii )
+    {
+      ASSERT_DOUBLE_EQ( table_e->Evaluate( &inputs[ii][0] ), output[ii] );
+    }
+  }
+
+  // On a vertex of the evenly spaced axis, upper interpolation returns the vertex value
+  real64 const vertex[2] = { coordinates[0][3], coordinates[1][1] };
+  table_e->setInterpolationMethod( TableFunction::InterpolationType::Upper );
+  ASSERT_DOUBLE_EQ( table_e->Evaluate( vertex ), values[Nx + 3] );
+}
+
+
 TEST( FunctionTests, 4DTable_multipleInputs )
 {
   FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
@@ -431,6 +520,53 @@ TEST( FunctionTests, 4DTable_symbolic )
   }
 }
 
+
+TEST( FunctionTests, symbolicBatch )
+{
+  FunctionManager * functionManager = &FunctionManager::FunctionManager::Instance();
+
+  // Symbolic function with three inputs, evaluated from structure-of-arrays inputs
+  string expression = "x*y-sin(z)+2.0";
+  localIndex Nvar = 3;
+  localIndex Ntest = 1000;
+
+  string_array variableNames( Nvar );
+  variableNames[0] = "x";
+  variableNames[1] = "y";
+  variableNames[2] = "z";
+
+  SymbolicFunction * function = functionManager->CreateChild( "SymbolicFunction", "symbolic_batch" )->group_cast< SymbolicFunction * >();
+  function->setSymbolicExpression( expression );
+  function->setSymbolicVariableNames( variableNames );
+  function->InitializeFunction();
+
+  // Build the inputs
+  real64_array2d inputs( Nvar, Ntest );
+  real64_array expected( Ntest );
+  real64_array output( Ntest );
+
+  std::default_random_engine generator;
+  std::uniform_real_distribution< double > distribution( -1.0, 1.0 );
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    real64 const x = distribution( generator );
+    real64 const y = distribution( generator );
+    real64 const z = distribution( generator );
+    inputs[0][ii] = x;
+    inputs[1][ii] = y;
+    inputs[2][ii] = z;
+    expected[ii] = x*y - sin( z ) + 2.0;
+  }
+
+  function->EvaluateBatch< parallelHostPolicy >( inputs.toViewConst(), output.toView() );
+
+  // Compare results
+  for( localIndex ii=0; ii<Ntest; ++ii )
+  {
+    ASSERT_NEAR( expected[ii], output[ii], 1e-10 );
+  }
+}
+
 #endif
 
 
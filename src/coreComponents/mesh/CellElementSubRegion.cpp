@@ -30,7 +30,12 @@ CellElementSubRegion::CellElementSubRegion( string const & name, Group * const p
 
   registerWrapper( viewKeyStruct::constitutivePointVolumeFraction, &m_constitutivePointVolumeFraction );
 
+#if defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
+  // Not stored: keep it empty when the subregion is resized (e.g. by the SurfaceGenerator or at restart)
+  registerWrapper( viewKeyStruct::dNdXString, &m_dNdX )->setSizedFromParent( 0 )->reference().resizeDimension< 3 >( 3 );
+#else
   registerWrapper( viewKeyStruct::dNdXString, &m_dNdX )->setSizedFromParent( 1 )->reference().resizeDimension< 3 >( 3 );
+#endif
 
   registerWrapper( viewKeyStruct::detJString, &m_detJ )->setSizedFromParent( 1 )->reference();
 }
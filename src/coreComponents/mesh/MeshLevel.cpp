@@ -33,7 +33,8 @@ MeshLevel::MeshLevel( string const & name,
   m_nodeManager( groupStructKeys::nodeManagerString, this ),
   m_edgeManager( groupStructKeys::edgeManagerString, this ),
   m_faceManager( groupStructKeys::faceManagerString, this ),
-  m_elementManager( groupStructKeys::elemManagerString, this )
+  m_elementManager( groupStructKeys::elemManagerString, this ),
+  m_topologyEpoch( 0 )
 {
 
   RegisterGroup( groupStructKeys::nodeManagerString, &m_nodeManager );
@@ -139,6 +139,21 @@ public:
    */
   ElementRegionManager * getElemManager()             { return &m_elementManager; }
 
+  /**
+   * @brief Get the topology epoch.
+   * @return the number of topology changes announced through incrementTopologyEpoch()
+   *
+   * Data derived from the connectivity or the ghost lists, such as a SynchronizationPlan,
+   * records the epoch it was built for and compares it to detect a topology change.
+   */
+  integer topologyEpoch() const { return m_topologyEpoch; }
+
+  /**
+   * @brief Announce a change of the connectivity or of the ghost lists.
+   * @note This must be called on all ranks, so that the epoch has the same value everywhere.
+   */
+  void incrementTopologyEpoch() { ++m_topologyEpoch; }
+
   ///@}
 
 private:
@@ -152,6 +167,9 @@ private:
   /// Manager for element data
   ElementRegionManager m_elementManager;
 
+  /// Number of topology changes of the mesh level
+  integer m_topologyEpoch;
+
 };
 
 } /* namespace geosx */
@@ -18,6 +18,7 @@
 
 #include "PAMELAMeshGenerator.hpp"
 
+#include "common/TimingMacros.hpp"
 #include "managers/DomainPartition.hpp"
 
 #include <math.h>
@@ -65,8 +66,10 @@ PAMELAMeshGenerator::~PAMELAMeshGenerator()
 void PAMELAMeshGenerator::GenerateElementRegions( DomainPartition & GEOSX_UNUSED_PARAM( domain ) )
 {}
 
-void PAMELAMeshGenerator::PostProcessInput()
+void PAMELAMeshGenerator::ImportPAMELAMesh()
 {
+  GEOSX_MARK_FUNCTION;
+
   m_pamelaMesh =
     std::unique_ptr< PAMELA::Mesh >
       ( PAMELA::MeshFactory::makeMesh( m_filePath ) );
@@ -91,6 +94,10 @@ Group * PAMELAMeshGenerator::CreateChild( string const & GEOSX_UNUSED_PARAM( chi
 
 void PAMELAMeshGenerator::GenerateMesh( DomainPartition * const domain )
 {
+  GEOSX_MARK_FUNCTION;
+
+  ImportPAMELAMesh();
+
   GEOSX_LOG_RANK_0( "Writing into the GEOSX mesh data structure" );
   domain->getMetisNeighborList() = m_pamelaMesh->getNeighborList();
   Group * const meshBodies = domain->GetGroup( std::string( "MeshBodies" ));
@@ -391,6 +398,10 @@ void PAMELAMeshGenerator::GenerateMesh( DomainPartition * const domain )
     }
   }
 
+  // Everything needed has been copied, release the PAMELA mesh and its
+  // global connectivity instead of keeping it for the whole simulation.
+  m_pamelaMesh.reset();
+
 }
 
 void PAMELAMeshGenerator::GetElemToNodesRelationInBox( const std::string & GEOSX_UNUSED_PARAM( elementType ),
@@ -87,18 +87,16 @@ public:
 
   virtual void RemapMesh ( dataRepository::Group * const domain ) override;
 
-protected:
+private:
 
   /**
-   * @brief This function provides capability to post process input values prior to
-   * any other initialization operations.
+   * @brief Read the mesh file and partition it with PAMELA.
+   *
+   * The PAMELA mesh is only alive during GenerateMesh.
    */
-  void PostProcessInput() override final;
-
-
-private:
+  void ImportPAMELAMesh();
 
-  /// Unique Pointer to the Mesh in the data structure of PAMELA.
+  /// Unique Pointer to the Mesh in the data structure of PAMELA, only set while the mesh is generated.
   std::unique_ptr< PAMELA::Mesh >  m_pamelaMesh;
 
   /// Names of the fields to be copied from PAMELA to GEOSX data structure
@@ -863,5 +863,214 @@ void CommunicationTools::SynchronizeFields( const std::map< string, string_array
   SynchronizeUnpack( mesh, neighbors, icomm, on_device );
 }
 
+void CommunicationTools::SetupSynchronizationPlan( const std::map< string, string_array > & fieldNames,
+                                                   MeshLevel * const mesh,
+                                                   std::vector< NeighborCommunicator > & neighbors,
+                                                   SynchronizationPlan & plan,
+                                                   bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  plan.reset();
+
+  MPI_iCommData & icomm = plan.icomm;
+  icomm.fieldNames = fieldNames;
+  icomm.resize( neighbors.size() );
+
+  // exchange the buffer sizes once; they stay valid as long as the ghost lists do
+  for( std::size_t neighborIndex=0; neighborIndex<neighbors.size(); ++neighborIndex )
+  {
+    NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    int const bufferSize = neighbor.PackCommSizeForSync( fieldNames, *mesh, icomm.commID, on_device );
+
+    neighbor.MPI_iSendReceiveBufferSizes( icomm.commID,
+                                          icomm.mpiSizeSendBufferRequest[neighborIndex],
+                                          icomm.mpiSizeRecvBufferRequest[neighborIndex],
+                                          MPI_COMM_GEOSX );
+
+    neighbor.resizeSendBuffer( icomm.commID, bufferSize );
+  }
+
+  MpiWrapper::Waitall( icomm.size,
+                       icomm.mpiSizeRecvBufferRequest.data(),
+                       icomm.mpiSizeRecvBufferStatus.data() );
+
+  MpiWrapper::Waitall( icomm.size,
+                       icomm.mpiSizeSendBufferRequest.data(),
+                       icomm.mpiSizeSendBufferStatus.data() );
+
+  for( NeighborCommunicator & neighbor : neighbors )
+  {
+    neighbor.resizeRecvBuffer( icomm.commID, neighbor.ReceiveBufferSize( icomm.commID ) );
+  }
+
+  if( plan.usePersistentRequests )
+  {
+    plan.persistentSendRequests.resize( neighbors.size() );
+    plan.persistentRecvRequests.resize( neighbors.size() );
+    for( std::size_t neighborIndex=0; neighborIndex<neighbors.size(); ++neighborIndex )
+    {
+      neighbors[neighborIndex].MPI_SendReceiveBuffersInit( icomm.commID,
+                                                           plan.persistentSendRequests[neighborIndex],
+                                                           plan.persistentRecvRequests[neighborIndex],
+                                                           MPI_COMM_GEOSX );
+    }
+  }
+
+  plan.mesh = mesh;
+  plan.topologyEpoch = mesh->topologyEpoch();
+  SynchronizationPlan::computeGhostCounts( fieldNames, *mesh, neighbors, plan.ghostCounts );
+  plan.isSetUp = true;
+}
+
+void CommunicationTools::SynchronizePackSendRecv( const std::map< string, string_array > & fieldNames,
+                                                  MeshLevel * const mesh,
+                                                  std::vector< NeighborCommunicator > & neighbors,
+                                                  SynchronizationPlan & plan,
+                                                  bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  // The size exchange in SetupSynchronizationPlan involves all neighbors. The decision to rebuild only
+  // depends on the fields, the mesh level and its topology epoch, which agree across ranks.
+  if( !plan.matches( fieldNames, mesh, neighbors ) )
+  {
+    SetupSynchronizationPlan( fieldNames, mesh, neighbors, plan, on_device );
+  }
+  else
+  {
+    GEOSX_ERROR_IF( !plan.hasSameGhostCounts( *mesh, neighbors ),
+                    "The ghost lists changed without a topology epoch increment, see MeshLevel::incrementTopologyEpoch()" );
+  }
+
+  MPI_iCommData & icomm = plan.icomm;
+  for( NeighborCommunicator & neighbor : neighbors )
+  {
+    neighbor.PackCommBufferForSync( fieldNames, *mesh, icomm.commID, on_device );
+  }
+
+  if( plan.usePersistentRequests )
+  {
+    MpiWrapper::Startall( icomm.size, plan.persistentRecvRequests.data() );
+    MpiWrapper::Startall( icomm.size, plan.persistentSendRequests.data() );
+  }
+  else
+  {
+    for( std::size_t neighborIndex=0; neighborIndex<neighbors.size(); ++neighborIndex )
+    {
+      neighbors[neighborIndex].MPI_iSendReceiveBuffers( icomm.commID,
+                                                        icomm.mpiSendBufferRequest[neighborIndex],
+                                                        icomm.mpiRecvBufferRequest[neighborIndex],
+                                                        MPI_COMM_GEOSX );
+    }
+  }
+}
+
+void CommunicationTools::SynchronizeUnpack( MeshLevel * const mesh,
+                                            std::vector< NeighborCommunicator > & neighbors,
+                                            SynchronizationPlan & plan,
+                                            bool on_device )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MPI_iCommData & icomm = plan.icomm;
+  MPI_Request * const sendRequests = plan.usePersistentRequests ? plan.persistentSendRequests.data()
+                                                                : icomm.mpiSendBufferRequest.data();
+  MPI_Request * const recvRequests = plan.usePersistentRequests ? plan.persistentRecvRequests.data()
+                                                                : icomm.mpiRecvBufferRequest.data();
+
+  // unpack the buffers
+  for( std::size_t count=0; count<neighbors.size(); ++count )
+  {
+    int neighborIndex;
+    MpiWrapper::Waitany( icomm.size,
+                         recvRequests,
+                         &neighborIndex,
+                         icomm.mpiRecvBufferStatus.data() );
+
+    NeighborCommunicator & neighbor = neighbors[neighborIndex];
+    neighbor.UnpackBufferForSync( icomm.fieldNames, mesh, icomm.commID, on_device );
+  }
+
+  MpiWrapper::Waitall( icomm.size,
+                       sendRequests,
+                       icomm.mpiSendBufferStatus.data() );
+}
+
+void CommunicationTools::SynchronizeFields( const std::map< string, string_array > & fieldNames,
+                                            MeshLevel * const mesh,
+                                            std::vector< NeighborCommunicator > & neighbors,
+                                            SynchronizationPlan & plan,
+                                            bool on_device )
+{
+  SynchronizePackSendRecv( fieldNames, mesh, neighbors, plan, on_device );
+  SynchronizeUnpack( mesh, neighbors, plan, on_device );
+}
+
+SynchronizationPlan::SynchronizationPlan( bool const persistentRequests ):
+  icomm(),
+  mesh( nullptr ),
+  topologyEpoch( 0 ),
+  ghostCounts(),
+  isSetUp( false ),
+  usePersistentRequests( persistentRequests ),
+  persistentSendRequests(),
+  persistentRecvRequests()
+{}
+
+SynchronizationPlan::~SynchronizationPlan()
+{
+  reset();
+}
+
+void SynchronizationPlan::reset()
+{
+  for( localIndex i = 0; i < persistentSendRequests.size(); ++i )
+  {
+    MpiWrapper::Request_free( &persistentSendRequests[i] );
+    MpiWrapper::Request_free( &persistentRecvRequests[i] );
+  }
+  persistentSendRequests.clear();
+  persistentRecvRequests.clear();
+
+  icomm.fieldNames.clear();
+  mesh = nullptr;
+  topologyEpoch = 0;
+  ghostCounts.clear();
+  isSetUp = false;
+}
+
+bool SynchronizationPlan::matches( std::map< string, string_array > const & fieldNames,
+                                   MeshLevel const * const meshLevel,
+                                   std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  return isSetUp &&
+         meshLevel == mesh &&
+         meshLevel->topologyEpoch() == topologyEpoch &&
+         icomm.size == static_cast< int >( neighbors.size() ) &&
+         icomm.fieldNames == fieldNames;
+}
+
+bool SynchronizationPlan::hasSameGhostCounts( MeshLevel const & meshLevel,
+                                              std::vector< NeighborCommunicator > const & neighbors ) const
+{
+  std::vector< localIndex > currentGhostCounts;
+  computeGhostCounts( icomm.fieldNames, meshLevel, neighbors, currentGhostCounts );
+  return currentGhostCounts == ghostCounts;
+}
+
+void SynchronizationPlan::computeGhostCounts( std::map< string, string_array > const & fieldNames,
+                                              MeshLevel const & meshLevel,
+                                              std::vector< NeighborCommunicator > const & neighbors,
+                                              std::vector< localIndex > & counts )
+{
+  counts.clear();
+  for( NeighborCommunicator const & neighbor : neighbors )
+  {
+    counts.emplace_back( neighbor.NeighborRank() );
+    neighbor.AppendSyncGhostCounts( fieldNames, meshLevel, counts );
+  }
+}
+
 
 } /* namespace geosx */
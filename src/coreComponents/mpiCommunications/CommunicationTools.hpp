@@ -35,6 +35,7 @@ class MeshLevel;
 class ElementRegionManager;
 
 class MPI_iCommData;
+class SynchronizationPlan;
 
 
 class CommunicationTools
@@ -89,6 +90,54 @@ public:
                                  MPI_iCommData & icomm,
                                  bool on_device = false );
 
+  /**
+   * @brief Synchronize fields using a plan that is kept across calls.
+   * @param fieldNames the fields to synchronize, keyed by object type
+   * @param mesh the mesh level
+   * @param neighbors the neighbor communicators
+   * @param plan the cached synchronization plan, (re)built when it does not match the request
+   * @param on_device whether to pack/unpack on device
+   */
+  static void SynchronizeFields( const std::map< string, string_array > & fieldNames,
+                                 MeshLevel * const mesh,
+                                 std::vector< NeighborCommunicator > & neighbors,
+                                 SynchronizationPlan & plan,
+                                 bool on_device = false );
+
+  /**
+   * @brief Pack the fields and start the exchange using a cached plan, skipping the buffer size exchange.
+   * @param fieldNames the fields to synchronize, keyed by object type
+   * @param mesh the mesh level
+   * @param neighbors the neighbor communicators
+   * @param plan the cached synchronization plan, (re)built when it does not match the request
+   * @param on_device whether to pack on device
+   */
+  static void SynchronizePackSendRecv( const std::map< string, string_array > & fieldNames,
+                                       MeshLevel * const mesh,
+                                       std::vector< NeighborCommunicator > & neighbors,
+                                       SynchronizationPlan & plan,
+                                       bool on_device = false );
+
+  /**
+   * @brief Complete an exchange started with a cached plan and unpack the received fields.
+   * @param mesh the mesh level
+   * @param neighbors the neighbor communicators
+   * @param plan the synchronization plan used to start the exchange
+   * @param on_device whether to unpack on device
+   */
+  static void SynchronizeUnpack( MeshLevel * const mesh,
+                                 std::vector< NeighborCommunicator > & neighbors,
+                                 SynchronizationPlan & plan,
+                                 bool on_device = false );
+
+private:
+
+  static void SetupSynchronizationPlan( const std::map< string, string_array > & fieldNames,
+                                        MeshLevel * const mesh,
+                                        std::vector< NeighborCommunicator > & neighbors,
+                                        SynchronizationPlan & plan,
+                                        bool on_device );
+
 
 };
 
@@ -154,6 +203,97 @@ public:
   array1d< MPI_Status >  mpiSizeRecvBufferStatus;
 };
 
+/**
+ * @class SynchronizationPlan
+ * @brief Buffers, sizes and (optionally) persistent MPI requests for a recurring field synchronization.
+ *
+ * The first synchronization through a plan exchanges the buffer sizes with the neighbors and sizes the
+ * communication buffers. Later synchronizations of the same fields on the same mesh reuse the buffers
+ * and skip the size exchange. The plan rebuilds itself when the field set, the mesh, the number of
+ * neighbors or the topology epoch of the mesh (see MeshLevel::incrementTopologyEpoch()) change. These
+ * are the same on all ranks, so the check is local and the neighbors rebuild their side of the exchange
+ * together without extra communication. Ghost lists that change without an epoch increment are an
+ * error. A change in the packed size of a field that leaves the ghost lists untouched (e.g. resizing
+ * the second dimension of a synchronized array) is not detected, and requires a call to reset().
+ */
+class SynchronizationPlan
+{
+public:
+
+  /**
+   * @brief Constructor.
+   * @param persistentRequests whether to create persistent MPI requests (MPI_Send_init/MPI_Recv_init)
+   *        on the cached buffers instead of posting new non-blocking requests at each synchronization
+   */
+  explicit SynchronizationPlan( bool const persistentRequests = false );
+
+  ~SynchronizationPlan();
+
+  SynchronizationPlan( SynchronizationPlan const & ) = delete;
+  SynchronizationPlan & operator=( SynchronizationPlan const & ) = delete;
+
+  /**
+   * @brief Drop the cached sizes and free the persistent requests; the next synchronization rebuilds the plan.
+   */
+  void reset();
+
+  /**
+   * @brief Check whether the plan can be reused for a synchronization.
+   * @param fieldNames the fields to synchronize, keyed by object type
+   * @param meshLevel the mesh level
+   * @param neighbors the neighbor communicators
+   * @return true if the plan was built for these fields, on this mesh level, at its current topology epoch
+   */
+  bool matches( std::map< string, string_array > const & fieldNames,
+                MeshLevel const * const meshLevel,
+                std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Check that the ghost lists are still the ones the plan was built for.
+   * @param meshLevel the mesh level
+   * @param neighbors the neighbor communicators
+   * @return true if the ghost counts have not changed
+   */
+  bool hasSameGhostCounts( MeshLevel const & meshLevel,
+                           std::vector< NeighborCommunicator > const & neighbors ) const;
+
+  /**
+   * @brief Compute the ghost counts that the plan is keyed on.
+   * @param fieldNames the fields to synchronize, keyed by object type
+   * @param meshLevel the mesh level
+   * @param neighbors the neighbor communicators
+   * @param counts the neighbor ranks and ghost counts, per neighbor and object manager
+   */
+  static void computeGhostCounts( std::map< string, string_array > const & fieldNames,
+                                  MeshLevel const & meshLevel,
+                                  std::vector< NeighborCommunicator > const & neighbors,
+                                  std::vector< localIndex > & counts );
+
+  /// The communication ids, requests and fields of the synchronization
+  MPI_iCommData icomm;
+
+  /// The mesh level the plan was built for
+  MeshLevel const * mesh;
+
+  /// The topology epoch of the mesh level the plan was built for
+  integer topologyEpoch;
+
+  /// The ghost counts (per neighbor and object manager) the plan was built for
+  std::vector< localIndex > ghostCounts;
+
+  /// Whether the plan has been built
+  bool isSetUp;
+
+  /// Whether the plan uses persistent requests
+  bool const usePersistentRequests;
+
+  /// The persistent send requests, one per neighbor
+  array1d< MPI_Request > persistentSendRequests;
+
+  /// The persistent receive requests, one per neighbor
+  array1d< MPI_Request > persistentRecvRequests;
+};
+
 
 
 } /* namespace geosx */
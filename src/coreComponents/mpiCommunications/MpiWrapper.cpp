@@ -164,6 +164,26 @@ int MpiWrapper::Test( MPI_Request * request, int * flag, MPI_Status * status )
   return 0;
 }
 
+int MpiWrapper::Request_free( MPI_Request * request )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Request_free( request );
+#else
+  *request = MPI_REQUEST_NULL;
+  return MPI_SUCCESS;
+#endif
+}
+
+int MpiWrapper::Startall( int count, MPI_Request array_of_requests[] )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Startall( count, array_of_requests );
+#else
+  GEOSX_UNUSED_VAR( count, array_of_requests );
+  return MPI_SUCCESS;
+#endif
+}
+
 int MpiWrapper::Wait( MPI_Request * request, MPI_Status * status )
 {
 #ifdef GEOSX_USE_MPI
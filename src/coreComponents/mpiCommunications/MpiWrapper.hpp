@@ -186,6 +186,10 @@ public:
 
   static MPI_Comm Comm_split( MPI_Comm const comm, int color, int key );
 
+  static int Request_free( MPI_Request * request );
+
+  static int Startall( int count, MPI_Request array_of_requests[] );
+
   static int Test( MPI_Request * request, int * flag, MPI_Status * status );
 
   static int Wait( MPI_Request * request, MPI_Status * status );
@@ -320,6 +324,19 @@ public:
   template< typename T >
   static int allReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Iallreduce.
+   * @param[in] sendbuf The pointer to the sending buffer.
+   * @param[out] recvbuf The pointer to the receive buffer, valid once @p request has completed.
+   * @param[in] count The number of values to send/receive.
+   * @param[in] op The MPI_Op to perform.
+   * @param[in] comm The MPI_Comm over which the reduction operates.
+   * @param[out] request Pointer to the MPI_Request associated with this reduction.
+   * @return The return value of the underlying call to MPI_Iallreduce().
+   */
+  template< typename T >
+  static int iAllReduce( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm, MPI_Request * request );
+
 
   template< typename T >
   static int scan( T const * sendbuf, T * recvbuf, int count, MPI_Op op, MPI_Comm comm );
@@ -459,6 +476,42 @@ public:
                     MPI_Comm comm,
                     MPI_Request * request );
 
+  /**
+   * @brief Strongly typed wrapper around MPI_Recv_init()
+   * @param[out] buf The pointer to the buffer that will receive the data on each start of the request.
+   * @param[in] count The number of elements in \p buf
+   * @param[in] source The rank of the source process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages
+   * @param[in] comm The handle to the MPI_Comm
+   * @param[out] request Pointer to the persistent MPI_Request, to be released with Request_free().
+   * @return
+   */
+  template< typename T >
+  static int recvInit( T * const buf,
+                       int count,
+                       int source,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
+  /**
+   * @brief Strongly typed wrapper around MPI_Send_init()
+   * @param[in] buf The pointer to the buffer that is sent on each start of the request.
+   * @param[in] count The number of elements in \p buf.
+   * @param[in] dest The rank of the destination process within \p comm.
+   * @param[in] tag The message tag that is be used to distinguish different types of messages.
+   * @param[in] comm The handle to the MPI_Comm.
+   * @param[out] request Pointer to the persistent MPI_Request, to be released with Request_free().
+   * @return
+   */
+  template< typename T >
+  static int sendInit( T const * const buf,
+                       int count,
+                       int dest,
+                       int tag,
+                       MPI_Comm comm,
+                       MPI_Request * request );
+
   /**
    * @brief Convenience function for a MPI_Reduce using a MPI_MIN operation.
    * @param value the value to send into the reduction.
@@ -626,6 +679,24 @@ int MpiWrapper::allReduce( T const * const sendbuf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::iAllReduce( T const * const sendbuf,
+                            T * const recvbuf,
+                            int count,
+                            MPI_Op MPI_PARAM( op ),
+                            MPI_Comm MPI_PARAM( comm ),
+                            MPI_Request * const request )
+{
+#ifdef GEOSX_USE_MPI
+  MPI_Datatype const MPI_TYPE = getMpiType< T >();
+  return MPI_Iallreduce( sendbuf, recvbuf, count, MPI_TYPE, op, comm, request );
+#else
+  memcpy( recvbuf, sendbuf, count*sizeof(T) );
+  *request = MPI_REQUEST_NULL;
+  return 0;
+#endif
+}
+
 template< typename T >
 int MpiWrapper::scan( T const * const sendbuf,
                       T * const recvbuf,
@@ -850,6 +921,38 @@ int MpiWrapper::iSend( T const * const buf,
 #endif
 }
 
+template< typename T >
+int MpiWrapper::recvInit( T * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( source ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Recv_init( buf, count, getMpiType< T >(), source, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
+template< typename T >
+int MpiWrapper::sendInit( T const * const MPI_PARAM( buf ),
+                          int MPI_PARAM( count ),
+                          int MPI_PARAM( dest ),
+                          int MPI_PARAM( tag ),
+                          MPI_Comm MPI_PARAM( comm ),
+                          MPI_Request * MPI_PARAM( request ) )
+{
+#ifdef GEOSX_USE_MPI
+  return MPI_Send_init( buf, count, getMpiType< T >(), dest, tag, comm, request );
+#else
+  GEOSX_ERROR( "Not implemented." );
+  return MPI_SUCCESS;
+#endif
+}
+
 template< typename U, typename T >
 U MpiWrapper::PrefixSum( T const value )
 {
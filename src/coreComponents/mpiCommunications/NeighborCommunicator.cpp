@@ -118,6 +118,28 @@ void NeighborCommunicator::MPI_iSendReceiveBuffers( int const commID,
 
 }
 
+void NeighborCommunicator::MPI_SendReceiveBuffersInit( int const commID,
+                                                       MPI_Request & mpiSendRequest,
+                                                       MPI_Request & mpiRecvRequest,
+                                                       MPI_Comm mpiComm )
+{
+  m_receiveBuffer[commID].resize( m_receiveBufferSize[commID] );
+
+  MpiWrapper::sendInit( m_sendBuffer[commID].data(),
+                        LvArray::integerConversion< int >( m_sendBuffer[commID].size()),
+                        m_neighborRank,
+                        CommTag( MpiWrapper::Comm_rank(), m_neighborRank, commID ),
+                        mpiComm,
+                        &mpiSendRequest );
+
+  MpiWrapper::recvInit( m_receiveBuffer[commID].data(),
+                        LvArray::integerConversion< int >( m_receiveBuffer[commID].size()),
+                        m_neighborRank,
+                        CommTag( m_neighborRank, MpiWrapper::Comm_rank(), commID ),
+                        mpiComm,
+                        &mpiRecvRequest );
+}
+
 void NeighborCommunicator::MPI_iSendReceive( int const commID,
                                              MPI_Comm mpiComm )
 {
@@ -593,6 +615,41 @@ int NeighborCommunicator::PackCommSizeForSync( std::map< string, string_array >
   return bufferSize;
 }
 
+void NeighborCommunicator::AppendSyncGhostCounts( std::map< string, string_array > const & fieldNames,
+                                                  MeshLevel const & mesh,
+                                                  std::vector< localIndex > & ghostCounts ) const
+{
+  auto appendCounts = [&]( ObjectManagerBase const & manager )
+  {
+    NeighborData const & neighborData = manager.getNeighborData( m_neighborRank );
+    ghostCounts.emplace_back( neighborData.ghostsToSend().size() );
+    ghostCounts.emplace_back( neighborData.ghostsToReceive().size() );
+  };
+
+  if( fieldNames.count( "node" ) > 0 )
+  {
+    appendCounts( *(mesh.getNodeManager()) );
+  }
+
+  if( fieldNames.count( "edge" ) > 0 )
+  {
+    appendCounts( *(mesh.getEdgeManager()) );
+  }
+
+  if( fieldNames.count( "face" ) > 0 )
+  {
+    appendCounts( *(mesh.getFaceManager()) );
+  }
+
+  if( fieldNames.count( "elems" ) > 0 )
+  {
+    mesh.getElemManager()->forElementSubRegions< ElementSubRegionBase >( [&]( ElementSubRegionBase const & subRegion )
+    {
+      appendCounts( subRegion );
+    } );
+  }
+}
+
 
 void NeighborCommunicator::PackCommBufferForSync( std::map< string, string_array > const & fieldNames,
                                                   MeshLevel const & mesh,
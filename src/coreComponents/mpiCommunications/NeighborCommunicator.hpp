@@ -75,6 +75,20 @@ public:
                                 MPI_Request & mpiRecvRequest,
                                 MPI_Comm mpiComm );
 
+  /**
+   * @brief Create persistent send/receive requests on the current buffers for @p commID.
+   * @param commID the communication id of the buffers
+   * @param mpiSendRequest the persistent send request
+   * @param mpiRecvRequest the persistent receive request
+   * @param mpiComm the communicator
+   *
+   * The buffers must already be sized, and must not be resized while the requests are alive.
+   */
+  void MPI_SendReceiveBuffersInit( int const commID,
+                                   MPI_Request & mpiSendRequest,
+                                   MPI_Request & mpiRecvRequest,
+                                   MPI_Comm mpiComm );
+
   void MPI_iSendReceive( int const commID,
                          MPI_Comm mpiComm );
 
@@ -275,6 +289,17 @@ public:
                            int const commID,
                            bool on_device = false );
 
+  /**
+   * @brief Append the number of ghosts sent to and received from this neighbor for each object
+   *        manager involved in a field synchronization.
+   * @param fieldNames the fields to synchronize, keyed by object type
+   * @param meshLevel the mesh level
+   * @param ghostCounts the list to append the counts to
+   */
+  void AppendSyncGhostCounts( std::map< string, string_array > const & fieldNames,
+                              MeshLevel const & meshLevel,
+                              std::vector< localIndex > & ghostCounts ) const;
+
   void SendRecvBuffers( int const commID );
 
   void UnpackBufferForSync( std::map< string, string_array > const & fieldNames,
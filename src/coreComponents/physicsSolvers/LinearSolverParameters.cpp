@@ -69,6 +69,38 @@ LinearSolverParametersInput::LinearSolverParametersInput( std::string const & na
     setInputFlag( InputFlags::OPTIONAL )->
     setDescription( "Weakest-allowed tolerance for adaptive method" );
 
+  registerWrapper( viewKeyStruct::krylovOrthogString, &m_parameters.krylov.orthogonalization )->
+    setApplyDefaultValue( m_parameters.krylov.orthogonalization )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Orthogonalization scheme of the Krylov basis (GEOSX native GMRES only). "
+                    "``cgs2`` reduces all the dot products of an iteration in two global reductions. Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::Orthogonalization >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::krylovPipelinedString, &m_parameters.krylov.usePipelined )->
+    setApplyDefaultValue( m_parameters.krylov.usePipelined )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Use the pipelined variant of the method, which overlaps its single global reduction per iteration "
+                    "with the preconditioner and operator application (GEOSX native CG only)" );
+
+  registerWrapper( viewKeyStruct::precondReuseString, &m_parameters.reuse.policy )->
+    setApplyDefaultValue( m_parameters.reuse.policy )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Preconditioner setup reuse policy for iterative solvers. When enabled, the physics solver keeps "
+                    "the preconditioner across linear solves and uses GEOSX native Krylov solvers. Available options are:\n* " +
+                    EnumStrings< LinearSolverParameters::PreconditionerReuse >::concat( "\n* " ) );
+
+  registerWrapper( viewKeyStruct::precondMaxReuseString, &m_parameters.reuse.maxReuse )->
+    setApplyDefaultValue( m_parameters.reuse.maxReuse )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Maximum number of consecutive linear solves that reuse a preconditioner setup "
+                    "(for ``fixed`` policy; upper bound for other policies if positive)" );
+
+  registerWrapper( viewKeyStruct::precondReuseIterGrowString, &m_parameters.reuse.iterationGrowth )->
+    setApplyDefaultValue( m_parameters.reuse.iterationGrowth )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Relative growth of Krylov iteration count, compared to the first solve after setup, "
+                    "that triggers preconditioner recomputation (for ``adaptive`` policy)" );
+
   registerWrapper( viewKeyStruct::amgNumSweepsString, &m_parameters.amg.numSweeps )->
     setApplyDefaultValue( m_parameters.amg.numSweeps )->
     setInputFlag( InputFlags::OPTIONAL )->
@@ -112,6 +144,9 @@ void LinearSolverParametersInput::PostProcessInput()
   GEOSX_ERROR_IF_LT_MSG( m_parameters.krylov.relTolerance, 0.0, "Invalid value of " << viewKeyStruct::krylovTolString );
   GEOSX_ERROR_IF_GT_MSG( m_parameters.krylov.relTolerance, 1.0, "Invalid value of " << viewKeyStruct::krylovTolString );
 
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.maxReuse, 0, "Invalid value of " << viewKeyStruct::precondMaxReuseString );
+  GEOSX_ERROR_IF_LT_MSG( m_parameters.reuse.iterationGrowth, 0.0, "Invalid value of " << viewKeyStruct::precondReuseIterGrowString );
+
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ilu.fill, 0, "Invalid value of " << viewKeyStruct::iluFillString );
   GEOSX_ERROR_IF_LT_MSG( m_parameters.ilu.threshold, 0.0, "Invalid value of " << viewKeyStruct::iluThresholdString );
 
@@ -76,6 +76,12 @@ public:
     static constexpr auto krylovTolString         = "krylovTol";         ///< Krylov tolerance key
     static constexpr auto krylovAdaptiveTolString = "krylovAdaptiveTol"; ///< Krylov adaptive tolerance key
     static constexpr auto krylovWeakTolString     = "krylovWeakestTol";  ///< Krylov weakest tolerance key
+    static constexpr auto krylovOrthogString      = "krylovOrthogonalization"; ///< Krylov orthogonalization scheme key
+    static constexpr auto krylovPipelinedString   = "krylovPipelined";   ///< Krylov pipelined variant key
+
+    static constexpr auto precondReuseString         = "preconditionerReuse";            ///< Preconditioner reuse policy key
+    static constexpr auto precondMaxReuseString      = "preconditionerMaxReuse";         ///< Preconditioner max reuse key
+    static constexpr auto precondReuseIterGrowString = "preconditionerReuseIterGrowth";  ///< Preconditioner reuse iteration growth key
 
     static constexpr auto amgNumSweepsString = "amgNumSweeps";             ///< AMG number of sweeps key
     static constexpr auto amgSmootherString  = "amgSmootherType";          ///< AMG smoother type key
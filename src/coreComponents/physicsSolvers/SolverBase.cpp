@@ -15,6 +15,7 @@
 #include "SolverBase.hpp"
 #include "PhysicsSolverManager.hpp"
 
+#include "common/Stopwatch.hpp"
 #include "common/TimingMacros.hpp"
 #include "linearAlgebra/utilities/LinearSolverParameters.hpp"
 #include "linearAlgebra/solvers/KrylovSolver.hpp"
@@ -219,6 +220,8 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
   // TODO: Nonlinear step does not call its own setup, need to decide on consistent behavior
   ImplicitStepSetup( time_n, dt, domain );
 
+  m_precondReuse.newTimeStep = true;
+
   // zero out matrix/rhs before assembly
   m_localMatrix.setValues< parallelDevicePolicy<> >( 0.0 );
   m_localRhs.setValues< parallelDevicePolicy<> >( 0.0 );
@@ -240,9 +243,7 @@ real64 SolverBase::LinearImplicitStep( real64 const & time_n,
                            m_localRhs.toView() );
 
   // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-  m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-  m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-  m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+  ComposeParallelSystem();
 
   // Output the linear system matrix/rhs for debugging purposes
   DebugOutputSystem( 0.0, 0, 0, m_matrix, m_rhs );
@@ -426,6 +427,9 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
       ResetStateToBeginningOfStep( domain );
     }
 
+    // time step size has changed, a lagged preconditioner should not survive this
+    m_precondReuse.newTimeStep = true;
+
     // keep residual from previous iteration in case we need to do a line search
     real64 lastResidual = 1e99;
     integer & newtonIter = m_nonlinearSolverParameters.m_numNewtonIterations;
@@ -535,9 +539,7 @@ real64 SolverBase::NonlinearImplicitStep( real64 const & time_n,
       }
 
       // Compose parallel LA matrix/rhs out of local LA matrix/rhs
-      m_matrix.create( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
-      m_rhs.create( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
-      m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+      ComposeParallelSystem();
 
       // Output the linear system matrix/rhs for debugging purposes
       DebugOutputSystem( time_n, cycleNumber, newtonIter, m_matrix, m_rhs );
@@ -761,6 +763,33 @@ SolverBase::CalculateResidualNorm( DomainPartition const & GEOSX_UNUSED_PARAM( d
   return 0;
 }
 
+void SolverBase::ComposeParallelSystem()
+{
+  GEOSX_MARK_FUNCTION;
+
+  // The sparsity of the local matrix normally stays fixed between calls to SetupSystem,
+  // in which case only values are copied and the distributed structures are kept alive.
+  bool const structureReused = m_matrix.updateValues( m_localMatrix.toViewConst(), MPI_COMM_GEOSX );
+  m_rhs.updateValues( m_localRhs.toViewConst(), MPI_COMM_GEOSX );
+
+  if( structureReused && m_solution.created() )
+  {
+    m_solution.zero();
+  }
+  else
+  {
+    m_solution.createWithLocalSize( m_matrix.numLocalCols(), MPI_COMM_GEOSX );
+
+    // preconditioner setup refers to the old matrix; the one we created may also depend on old dof layout
+    m_precondReuse.setupValid = false;
+    if( m_precondReuse.ownedBySolverBase )
+    {
+      m_krylovSolver.reset();
+      m_precond.reset();
+    }
+  }
+}
+
 void SolverBase::SolveSystem( DofManager const & dofManager,
                               ParallelMatrix & matrix,
                               ParallelVector & rhs,
@@ -780,22 +809,78 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
 
   LinearSolverParameters const & params = m_linearSolverParameters.get();
 
-  // TODO: We probably want to keep an instance of linear solver as a member of physics solver
-  //       so we can have constant access to last solve statistics, convergence history, etc.
-  //       This requires unifying "LAI interface" solvers with "native" Krylov solvers somehow.
+  // Preconditioner reuse requires the setup to persist between solves, so we manage it here
+  if( !m_precond
+      && params.reuse.policy != LinearSolverParameters::PreconditionerReuse::never
+      && ( params.solverType == LinearSolverParameters::SolverType::cg
+           || params.solverType == LinearSolverParameters::SolverType::gmres
+           || params.solverType == LinearSolverParameters::SolverType::bicgstab ) )
+  {
+    m_precond = LAInterface::createPreconditioner( params, &dofManager );
+    m_precondReuse = PreconditionerReuseState();
+    m_precondReuse.ownedBySolverBase = true;
+  }
 
   if( params.solverType == LinearSolverParameters::SolverType::direct || !m_precond )
   {
     LinearSolver solver( params );
     solver.solve( matrix, solution, rhs, &dofManager );
     m_linearSolverResult = solver.result();
+    m_linearSolverResidualHistory.resize( 0 );
   }
   else
   {
-    m_precond->compute( matrix, dofManager );
-    std::unique_ptr< KrylovSolver< ParallelVector > > solver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
-    solver->solve( rhs, solution );
-    m_linearSolverResult = solver->result();
+    bool const recompute = PreconditionerSetupRequired( matrix );
+
+    Stopwatch watch;
+    if( recompute )
+    {
+      m_precond->compute( matrix, dofManager );
+      m_precondReuse.setupValid = true;
+      m_precondReuse.newTimeStep = false;
+      m_precondReuse.numReuses = 0;
+    }
+    else
+    {
+      ++m_precondReuse.numReuses;
+    }
+    real64 setupTime = watch.elapsedTime();
+
+    KrylovSolver< ParallelVector > & solver = GetKrylovSolver( matrix );
+    solver.solve( rhs, solution );
+    m_linearSolverResult = solver.result();
+
+    // A lagged preconditioner that fails to converge gets one more chance with a fresh setup
+    if( !recompute && !m_linearSolverResult.success() )
+    {
+      GEOSX_LOG_LEVEL_RANK_0( 1, getName() << ": linear solve with reused preconditioner failed, recomputing setup" );
+      watch.zero();
+      m_precond->compute( matrix, dofManager );
+      m_precondReuse.numReuses = 0;
+      setupTime += watch.elapsedTime();
+
+      solution.zero();
+      solver.solve( rhs, solution );
+      m_linearSolverResult = solver.result();
+    }
+
+    arrayView1d< real64 const > const & history = solver.history();
+    m_linearSolverResidualHistory.resize( history.size() );
+    for( localIndex i = 0; i < history.size(); ++i )
+    {
+      m_linearSolverResidualHistory[i] = history[i];
+    }
+
+    if( m_precondReuse.numReuses == 0 )
+    {
+      m_precondReuse.referenceIterations = m_linearSolverResult.numIterations;
+    }
+    m_precondReuse.setupValid = m_linearSolverResult.success();
+    m_linearSolverResult.setupTime = setupTime;
+
+    GEOSX_LOG_LEVEL_RANK_0( 2, getName() << ": preconditioner " << ( m_precondReuse.numReuses > 0 ? "reused" : "computed" )
+                                         << " | SetupTime " << m_linearSolverResult.setupTime
+                                         << " | SolveTime " << m_linearSolverResult.solveTime );
   }
 
   //  Keep for debugging comparisons
@@ -810,6 +895,68 @@ void SolverBase::SolveSystem( DofManager const & dofManager,
   GEOSX_WARNING_IF( !m_linearSolverResult.success(), "Linear solution failed" );
 }
 
+KrylovSolver< ParallelVector > & SolverBase::GetKrylovSolver( ParallelMatrix const & matrix )
+{
+  LinearSolverParameters const & params = m_linearSolverParameters.get();
+
+  // The solver keeps references to the operators, so it must be re-created if either has changed.
+  // Tolerance is the only parameter allowed to vary between solves (e.g. Eisenstat-Walker).
+  if( !m_krylovSolver
+      || m_krylovSolverMatrix != &matrix
+      || m_krylovSolverPrecond != m_precond.get()
+      || m_krylovSolverParameters.solverType != params.solverType
+      || m_krylovSolverParameters.isSymmetric != params.isSymmetric
+      || m_krylovSolverParameters.logLevel != params.logLevel
+      || m_krylovSolverParameters.krylov.maxIterations != params.krylov.maxIterations
+      || m_krylovSolverParameters.krylov.maxRestart != params.krylov.maxRestart
+      || m_krylovSolverParameters.krylov.orthogonalization != params.krylov.orthogonalization
+      || m_krylovSolverParameters.krylov.usePipelined != params.krylov.usePipelined )
+  {
+    m_krylovSolver = KrylovSolver< ParallelVector >::Create( params, matrix, *m_precond );
+    m_krylovSolverMatrix = &matrix;
+    m_krylovSolverPrecond = m_precond.get();
+    m_krylovSolverParameters = params;
+  }
+
+  m_krylovSolver->setTolerance( params.krylov.relTolerance );
+  return *m_krylovSolver;
+}
+
+bool SolverBase::PreconditionerSetupRequired( ParallelMatrix const & matrix ) const
+{
+  LinearSolverParameters::Reuse const & reuse = m_linearSolverParameters.get().reuse;
+
+  // The setup can only be reused on our own system matrix, whose structure is tracked by ComposeParallelSystem()
+  if( !m_precondReuse.setupValid || &matrix != &m_matrix || !m_precond->ready() || &m_precond->matrix() != &matrix )
+  {
+    return true;
+  }
+
+  switch( reuse.policy )
+  {
+    case LinearSolverParameters::PreconditionerReuse::never:
+    {
+      return true;
+    }
+    case LinearSolverParameters::PreconditionerReuse::fixed:
+    {
+      return m_precondReuse.numReuses >= reuse.maxReuse;
+    }
+    case LinearSolverParameters::PreconditionerReuse::adaptive:
+    {
+      real64 const maxIterations = ( 1.0 + reuse.iterationGrowth ) * m_precondReuse.referenceIterations;
+      return m_linearSolverResult.numIterations > maxIterations
+             || ( reuse.maxReuse > 0 && m_precondReuse.numReuses >= reuse.maxReuse );
+    }
+    case LinearSolverParameters::PreconditionerReuse::timeStep:
+    {
+      return m_precondReuse.newTimeStep
+             || ( reuse.maxReuse > 0 && m_precondReuse.numReuses >= reuse.maxReuse );
+    }
+  }
+  return true;
+}
+
 bool SolverBase::CheckSystemSolution( DomainPartition const & GEOSX_UNUSED_PARAM( domain ),
                                       DofManager const & GEOSX_UNUSED_PARAM( dofManager ),
                                       arrayView1d< real64 const > const & GEOSX_UNUSED_PARAM( localSolution ),
@@ -33,6 +33,7 @@ namespace geosx
 {
 
 class DomainPartition;
+template< typename VECTOR > class KrylovSolver;
 
 class SolverBase : public ExecutableGroup
 {
@@ -389,6 +390,14 @@ public:
                          DofManager const & dofManager,
                          arrayView1d< real64 const > const & localRhs );
 
+  /**
+   * @brief Compose the parallel matrix, rhs and solution vectors out of the local matrix/rhs.
+   *
+   * The parallel objects are only recreated when the sparsity pattern of the local matrix has
+   * changed since the previous call; otherwise only values are copied.
+   */
+  void ComposeParallelSystem();
+
   /**
    * @brief function to apply a linear system solver to the assembled system.
    * @param matrix the system matrix
@@ -563,6 +572,24 @@ public:
     return m_linearSolverParameters.get();
   }
 
+  /**
+   * @brief accessor for the result of the last linear solve.
+   * @return the linear solver result
+   */
+  LinearSolverResult const & getLinearSolverResult() const
+  {
+    return m_linearSolverResult;
+  }
+
+  /**
+   * @brief accessor for the convergence history of the last linear solve.
+   * @return absolute residual norms at every Krylov iteration (empty if the solver does not provide them)
+   */
+  arrayView1d< real64 const > getLinearSolverResidualHistory() const
+  {
+    return m_linearSolverResidualHistory;
+  }
+
   /**
    * @brief accessor for the nonlinear solver parameters.
    * @return the nonlinear solver parameter list
@@ -730,11 +757,51 @@ protected:
   /// Result of the last linear solve
   LinearSolverResult m_linearSolverResult;
 
+  /// Residual norm history of the last linear solve
+  array1d< real64 > m_linearSolverResidualHistory;
+
   /// Nonlinear solver parameters
   NonlinearSolverParameters m_nonlinearSolverParameters;
 
 private:
 
+  /**
+   * @brief Decide whether the preconditioner must be (re)computed before the next solve.
+   * @param matrix the matrix about to be solved
+   * @return @p true if a new setup is required by the reuse policy
+   */
+  bool PreconditionerSetupRequired( ParallelMatrix const & matrix ) const;
+
+  /**
+   * @brief Get the native Krylov solver for a matrix, re-creating it only when needed.
+   * @param matrix the system matrix
+   * @return the solver bound to @p matrix and the current preconditioner
+   */
+  KrylovSolver< ParallelVector > & GetKrylovSolver( ParallelMatrix const & matrix );
+
+  /// Native Krylov solver kept between linear solves, so that its work vectors are not reallocated
+  std::unique_ptr< KrylovSolver< ParallelVector > > m_krylovSolver;
+
+  /// Matrix the Krylov solver is bound to
+  ParallelMatrix const * m_krylovSolverMatrix = nullptr;
+
+  /// Preconditioner the Krylov solver is bound to
+  PreconditionerBase< LAInterface > const * m_krylovSolverPrecond = nullptr;
+
+  /// Parameters the Krylov solver was created with
+  LinearSolverParameters m_krylovSolverParameters;
+
+  /// Bookkeeping for preconditioner setup reuse across linear solves
+  struct PreconditionerReuseState
+  {
+    bool setupValid = false;           ///< Whether the current setup may be reused at all
+    bool newTimeStep = true;           ///< Whether a new time step (or cut) has started since last setup
+    bool ownedBySolverBase = false;    ///< Whether m_precond was created by SolverBase to enable reuse
+    integer numReuses = 0;             ///< Number of solves that reused the current setup
+    integer referenceIterations = 0;   ///< Krylov iterations of the first solve after setup
+  }
+  m_precondReuse;
+
   /// List of names of regions the solver will be applied to
   array1d< string > m_targetRegionNames;
 
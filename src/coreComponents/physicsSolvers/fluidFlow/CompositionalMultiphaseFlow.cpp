@@ -154,6 +154,9 @@ void CompositionalMultiphaseFlow::RegisterDataOnMesh( Group * const MeshBodies )
       elementSubRegion.registerWrapper< array2d< real64 > >( viewKeyStruct::phaseDensityOldString );
       elementSubRegion.registerWrapper< array3d< real64 > >( viewKeyStruct::phaseComponentFractionOldString );
       elementSubRegion.registerWrapper< array1d< real64 > >( viewKeyStruct::porosityOldString );
+
+      elementSubRegion.registerWrapper< array1d< localIndex > >( viewKeyStruct::diagonalBlockOffsetString )->
+        setRestartFlags( RestartFlags::NO_WRITE );
     } );
   }
 }
@@ -313,6 +316,35 @@ void CompositionalMultiphaseFlow::UpdateComponentFraction( Group & dataGroup ) c
                                                     dCompFrac_dCompDens );
 }
 
+void CompositionalMultiphaseFlow::UpdateComponentFraction( Group & dataGroup,
+                                                           SortedArrayView< localIndex const > const & targetSet ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  // outputs
+
+  arrayView2d< real64 > const & compFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompFractionString );
+
+  arrayView3d< real64 > const & dCompFrac_dCompDens =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dGlobalCompFraction_dGlobalCompDensityString );
+
+  // inputs
+
+  arrayView2d< real64 const > const & compDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompDensityString );
+
+  arrayView2d< real64 const > const & dCompDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
+
+  KernelLaunchSelector1< ComponentFractionKernel >( m_numComponents,
+                                                    targetSet,
+                                                    compDens,
+                                                    dCompDens,
+                                                    compFrac,
+                                                    dCompFrac_dCompDens );
+}
+
 void CompositionalMultiphaseFlow::UpdatePhaseVolumeFraction( Group & dataGroup,
                                                              localIndex const targetIndex ) const
 {
@@ -437,15 +469,42 @@ void CompositionalMultiphaseFlow::UpdateFluidModel( Group & dataGroup, localInde
 
   constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
   {
-    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
-
-    // MultiFluid models are not thread-safe or device-capable yet
-    FluidUpdateKernel::Launch< serialPolicy >( dataGroup.size(),
-                                               fluidWrapper,
-                                               pres,
-                                               dPres,
-                                               m_temperature,
-                                               compFrac );
+    using FluidType = TYPEOFREF( castedFluid );
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    // MultiFluid models are not device-capable yet; each model decides whether it can run host-parallel
+    FluidUpdateKernel::Launch< typename FluidType::UpdatePolicy >( dataGroup.size(),
+                                                                   fluidWrapper,
+                                                                   pres,
+                                                                   dPres,
+                                                                   m_temperature,
+                                                                   compFrac );
+  } );
+}
+
+void CompositionalMultiphaseFlow::UpdateFluidModel( Group & dataGroup,
+                                                    localIndex const targetIndex,
+                                                    SortedArrayView< localIndex const > const & targetSet ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const pres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+  arrayView1d< real64 const > const dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+  arrayView2d< real64 const > const compFrac = dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompFractionString );
+
+  MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    using FluidType = TYPEOFREF( castedFluid );
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    FluidUpdateKernel::Launch< typename FluidType::UpdatePolicy >( targetSet,
+                                                                   fluidWrapper,
+                                                                   pres,
+                                                                   dPres,
+                                                                   m_temperature,
+                                                                   compFrac );
   } );
 }
 
@@ -506,8 +565,134 @@ void CompositionalMultiphaseFlow::UpdateState( Group & dataGroup, localIndex con
 {
   GEOSX_MARK_FUNCTION;
 
-  UpdateComponentFraction( dataGroup );
-  UpdateFluidModel( dataGroup, targetIndex );
+  // outputs
+
+  arrayView2d< real64 > const & compFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompFractionString );
+
+  arrayView3d< real64 > const & dCompFrac_dCompDens =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dGlobalCompFraction_dGlobalCompDensityString );
+
+  arrayView2d< real64 > const & phaseVolFrac =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::phaseVolumeFractionString );
+
+  arrayView2d< real64 > const & dPhaseVolFrac_dPres =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::dPhaseVolumeFraction_dPressureString );
+
+  arrayView3d< real64 > const & dPhaseVolFrac_dComp =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dPhaseVolumeFraction_dGlobalCompDensityString );
+
+  arrayView2d< real64 > const & phaseMob =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::phaseMobilityString );
+
+  arrayView2d< real64 > const & dPhaseMob_dPres =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::dPhaseMobility_dPressureString );
+
+  arrayView3d< real64 > const & dPhaseMob_dComp =
+    dataGroup.getReference< array3d< real64 > >( viewKeyStruct::dPhaseMobility_dGlobalCompDensityString );
+
+  // inputs
+
+  arrayView1d< real64 const > const & pres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+
+  arrayView1d< real64 const > const & dPres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+  arrayView2d< real64 const > const & compDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::globalCompDensityString );
+
+  arrayView2d< real64 const > const & dCompDens =
+    dataGroup.getReference< array2d< real64 > >( viewKeyStruct::deltaGlobalCompDensityString );
+
+  MultiFluidBase & fluid = GetConstitutiveModel< MultiFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  arrayView3d< real64 const > const & phaseFrac = fluid.phaseFraction();
+  arrayView3d< real64 const > const & dPhaseFrac_dPres = fluid.dPhaseFraction_dPressure();
+  arrayView4d< real64 const > const & dPhaseFrac_dComp = fluid.dPhaseFraction_dGlobalCompFraction();
+
+  arrayView3d< real64 const > const & phaseDens = fluid.phaseDensity();
+  arrayView3d< real64 const > const & dPhaseDens_dPres = fluid.dPhaseDensity_dPressure();
+  arrayView4d< real64 const > const & dPhaseDens_dComp = fluid.dPhaseDensity_dGlobalCompFraction();
+
+  arrayView3d< real64 const > const & phaseVisc = fluid.phaseViscosity();
+  arrayView3d< real64 const > const & dPhaseVisc_dPres = fluid.dPhaseViscosity_dPressure();
+  arrayView4d< real64 const > const & dPhaseVisc_dComp = fluid.dPhaseViscosity_dGlobalCompFraction();
+
+  RelativePermeabilityBase & relPerm =
+    GetConstitutiveModel< RelativePermeabilityBase >( dataGroup, m_relPermModelNames[targetIndex] );
+
+  arrayView3d< real64 const > const & phaseRelPerm = relPerm.phaseRelPerm();
+  arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac = relPerm.dPhaseRelPerm_dPhaseVolFraction();
+
+  // component fractions, fluid properties, phase volume fractions, relative permeabilities
+  // and phase mobilities are updated cell by cell in a single pass over the subregion
+  bool fused = false;
+  constitutive::constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
+  {
+    using FluidType = TYPEOFREF( castedFluid );
+
+    // The fused pass runs with the policy of the fluid model. When that is less parallel than the
+    // separate passes (e.g. serial, or host-only in a device build), keep the separate passes.
+    if( !std::is_same< typename FluidType::UpdatePolicy, parallelDevicePolicy<> >::value )
+    {
+      return;
+    }
+    fused = true;
+
+    typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+    constitutive::constitutiveUpdatePassThru( relPerm, [&] ( auto & castedRelPerm )
+    {
+      typename TYPEOFREF( castedRelPerm ) ::KernelWrapper relPermWrapper = castedRelPerm.createKernelWrapper();
+
+      KernelLaunchSelector2< StateUpdateKernel< typename FluidType::UpdatePolicy > >( m_numComponents, m_numPhases,
+                                                                                     dataGroup.size(),
+                                                                                     fluidWrapper,
+                                                                                     relPermWrapper,
+                                                                                     pres,
+                                                                                     dPres,
+                                                                                     m_temperature,
+                                                                                     compDens,
+                                                                                     dCompDens,
+                                                                                     phaseFrac,
+                                                                                     dPhaseFrac_dPres,
+                                                                                     dPhaseFrac_dComp,
+                                                                                     phaseDens,
+                                                                                     dPhaseDens_dPres,
+                                                                                     dPhaseDens_dComp,
+                                                                                     phaseVisc,
+                                                                                     dPhaseVisc_dPres,
+                                                                                     dPhaseVisc_dComp,
+                                                                                     phaseRelPerm,
+                                                                                     dPhaseRelPerm_dPhaseVolFrac,
+                                                                                     compFrac,
+                                                                                     dCompFrac_dCompDens,
+                                                                                     phaseVolFrac,
+                                                                                     dPhaseVolFrac_dPres,
+                                                                                     dPhaseVolFrac_dComp,
+                                                                                     phaseMob,
+                                                                                     dPhaseMob_dPres,
+                                                                                     dPhaseMob_dComp );
+    } );
+  } );
+
+  if( !fused )
+  {
+    UpdateComponentFraction( dataGroup );
+    UpdateFluidModel( dataGroup, targetIndex );
+    UpdateFluidDependentState( dataGroup, targetIndex );
+    return;
+  }
+
+  UpdateSolidModel( dataGroup, targetIndex );
+  UpdateCapPressureModel( dataGroup, targetIndex );
+}
+
+void CompositionalMultiphaseFlow::UpdateFluidDependentState( Group & dataGroup, localIndex const targetIndex ) const
+{
+  GEOSX_MARK_FUNCTION;
+
   UpdatePhaseVolumeFraction( dataGroup, targetIndex );
   UpdateSolidModel( dataGroup, targetIndex );
   UpdateRelPermModel( dataGroup, targetIndex );
@@ -686,6 +871,76 @@ void CompositionalMultiphaseFlow::SetupDofs( DomainPartition const & domain,
   dofManager.addCoupling( viewKeyStruct::dofFieldString, fluxApprox );
 }
 
+void CompositionalMultiphaseFlow::SetupSystem( DomainPartition & domain,
+                                               DofManager & dofManager,
+                                               CRSMatrix< real64, globalIndex > & localMatrix,
+                                               array1d< real64 > & localRhs,
+                                               array1d< real64 > & localSolution,
+                                               bool const setSparsity )
+{
+  GEOSX_MARK_FUNCTION;
+
+  FlowSolverBase::SetupSystem( domain,
+                               dofManager,
+                               localMatrix,
+                               localRhs,
+                               localSolution,
+                               setSparsity );
+
+  SetupAssemblyMaps( domain, dofManager, localMatrix.toViewConst() );
+}
+
+void CompositionalMultiphaseFlow::SetupAssemblyMaps( DomainPartition & domain,
+                                                     DofManager const & dofManager,
+                                                     CRSMatrixView< real64 const, globalIndex const > const & localMatrix )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  ElementRegionManager const & elemManager = *mesh.getElemManager();
+
+  string const & dofKey = dofManager.getKey( viewKeyStruct::dofFieldString );
+
+  forTargetSubRegions( mesh, [&]( localIndex const, ElementSubRegionBase & subRegion )
+  {
+    arrayView1d< globalIndex const > const & dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
+    arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+    arrayView1d< localIndex > const & diagonalBlockOffset =
+      subRegion.getReference< array1d< localIndex > >( viewKeyStruct::diagonalBlockOffsetString );
+
+    AssemblyMapKernel::Launch( subRegion.size(),
+                               dofManager.rankOffset(),
+                               dofNumber,
+                               elemGhostRank,
+                               localMatrix,
+                               diagonalBlockOffset );
+  } );
+
+  NumericalMethodsManager const & numericalMethodManager = domain.getNumericalMethodManager();
+  FiniteVolumeManager const & fvManager = numericalMethodManager.getFiniteVolumeManager();
+  FluxApproximationBase const & fluxApprox = fvManager.getFluxApproximation( m_discretizationName );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< globalIndex const > >
+  elemDofNumber = elemManager.ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
+  elemDofNumber.setName( getName() + "/accessors/" + dofKey );
+
+  ElementRegionManager::ElementViewAccessor< arrayView1d< integer const > >
+  elemGhostRank = elemManager.ConstructArrayViewAccessor< integer, 1 >( ObjectManagerBase::viewKeyStruct::ghostRankString );
+  elemGhostRank.setName( getName() + "/accessors/" + ObjectManagerBase::viewKeyStruct::ghostRankString );
+
+  m_fluxAssemblyMaps.clear();
+  fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
+  {
+    m_fluxAssemblyMaps.emplace_back();
+    AssemblyMapKernel::Launch( stencil,
+                               dofManager.rankOffset(),
+                               elemDofNumber.toViewConst(),
+                               elemGhostRank.toViewConst(),
+                               localMatrix,
+                               m_fluxAssemblyMaps.back() );
+  } );
+}
+
 void CompositionalMultiphaseFlow::AssembleSystem( real64 const GEOSX_UNUSED_PARAM( time_n ),
                                                   real64 const dt,
                                                   DomainPartition & domain,
@@ -727,6 +982,8 @@ void CompositionalMultiphaseFlow::AssembleAccumulationTerms( DomainPartition con
   {
     arrayView1d< globalIndex const > const & dofNumber = subRegion.getReference< array1d< globalIndex > >( dofKey );
     arrayView1d< integer const > const & elemGhostRank = subRegion.ghostRank();
+    arrayView1d< localIndex const > const & diagonalBlockOffset =
+      subRegion.getReference< array1d< localIndex > >( viewKeyStruct::diagonalBlockOffsetString );
 
     arrayView1d< real64 const > const & volume = subRegion.getElementVolume();
     arrayView1d< real64 const > const & porosityRef =
@@ -788,6 +1045,7 @@ void CompositionalMultiphaseFlow::AssembleAccumulationTerms( DomainPartition con
                                                  phaseCompFrac,
                                                  dPhaseCompFrac_dPres,
                                                  dPhaseCompFrac_dComp,
+                                                 diagonalBlockOffset,
                                                  localMatrix,
                                                  localRhs );
   } );
@@ -846,8 +1104,16 @@ void CompositionalMultiphaseFlow::AssembleFluxTerms( real64 const dt,
   elemDofNumber = mesh.getElemManager()->ConstructArrayViewAccessor< globalIndex, 1 >( dofKey );
   elemDofNumber.setName( getName() + "/accessors/" + dofKey );
 
+  // a stencil without assembly map (empty view) is assembled by searching the columns
+  array3d< localIndex > const noAssemblyMap;
+  std::size_t stencilIndex = 0;
+
   fluxApprox.forAllStencils( mesh, [&] ( auto const & stencil )
   {
+    array3d< localIndex > const & assemblyMap =
+      stencilIndex < m_fluxAssemblyMaps.size() ? m_fluxAssemblyMaps[stencilIndex] : noAssemblyMap;
+    ++stencilIndex;
+
     KernelLaunchSelector1< FluxKernel >( m_numComponents,
                                          m_numPhases,
                                          stencil,
@@ -873,6 +1139,7 @@ void CompositionalMultiphaseFlow::AssembleFluxTerms( real64 const dt,
                                          m_dPhaseCapPressure_dPhaseVolFrac.toViewConst(),
                                          m_capPressureFlag,
                                          dt,
+                                         assemblyMap.toViewConst(),
                                          localMatrix.toViewConstSizes(),
                                          localRhs.toView() );
   } );
@@ -1112,14 +1379,15 @@ void CompositionalMultiphaseFlow::ApplyDirichletBC( real64 const time,
 
     constitutiveUpdatePassThru( fluid, [&] ( auto & castedFluid )
     {
-      typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
-
-      // MultiFluid models are not thread-safe or device-capable yet
-      FluidUpdateKernel::Launch< serialPolicy >( targetSet,
-                                                 fluidWrapper,
-                                                 bcPres,
-                                                 m_temperature,
-                                                 compFrac );
+      using FluidType = TYPEOFREF( castedFluid );
+      typename FluidType::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+
+      // MultiFluid models are not device-capable yet; each model decides whether it can run host-parallel
+      FluidUpdateKernel::Launch< typename FluidType::UpdatePolicy >( targetSet,
+                                                                     fluidWrapper,
+                                                                     bcPres,
+                                                                     m_temperature,
+                                                                     compFrac );
     } );
 
     forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const a )
@@ -1398,11 +1666,19 @@ void CompositionalMultiphaseFlow::ApplySystemSolution( DofManager const & dofMan
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaGlobalCompDensityString ) );
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
+
+  // the flash dominates the state update, so run it on owned elements while ghost values are in flight
+  SynchronizeFieldsWithOverlap( fieldNames, domain, [&]( localIndex const targetIndex,
+                                                         ElementSubRegionBase & subRegion,
+                                                         SortedArrayView< localIndex const > const & elems )
+  {
+    UpdateComponentFraction( subRegion, elems );
+    UpdateFluidModel( subRegion, targetIndex, elems );
+  } );
 
   forTargetSubRegions( mesh, [&]( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
-    UpdateState( subRegion, targetIndex );
+    UpdateFluidDependentState( subRegion, targetIndex );
   } );
 }
 
@@ -113,6 +113,14 @@ public:
   SetupDofs( DomainPartition const & domain,
              DofManager & dofManager ) const override;
 
+  virtual void
+  SetupSystem( DomainPartition & domain,
+               DofManager & dofManager,
+               CRSMatrix< real64, globalIndex > & localMatrix,
+               array1d< real64 > & localRhs,
+               array1d< real64 > & localSolution,
+               bool const setSparsity = true ) override;
+
   virtual void
   AssembleSystem( real64 const time_n,
                   real64 const dt,
@@ -171,6 +179,14 @@ public:
    */
   void UpdateComponentFraction( Group & dataGroup ) const;
 
+  /**
+   * @brief Recompute component fractions from primary variables on a subset of elements
+   * @param dataGroup the group storing the required fields
+   * @param targetSet the elements to update
+   */
+  void UpdateComponentFraction( Group & dataGroup,
+                                SortedArrayView< localIndex const > const & targetSet ) const;
+
   /**
    * @brief Recompute phase volume fractions (saturations) from constitutive and primary variables
    * @param dataGroup the group storing the required fields
@@ -183,6 +199,15 @@ public:
    */
   void UpdateFluidModel( Group & dataGroup, localIndex const targetIndex ) const;
 
+  /**
+   * @brief Update all relevant fluid models on a subset of elements
+   * @param dataGroup the group storing the required fields
+   * @param targetSet the elements to update
+   */
+  void UpdateFluidModel( Group & dataGroup,
+                         localIndex const targetIndex,
+                         SortedArrayView< localIndex const > const & targetSet ) const;
+
   /**
    * @brief Update all relevant solid models using current values of pressure
    * @param dataGroup the group storing the required fields
@@ -213,6 +238,13 @@ public:
    */
   void UpdateState( Group & dataGroup, localIndex const targetIndex ) const;
 
+  /**
+   * @brief Recompute the quantities that depend on fluid properties (saturations, solid, relperm, mobility, capillary pressure)
+   * @param dataGroup the group storing the required fields
+   * @param targetIndex the index of the target region, used to select the constitutive models
+   */
+  void UpdateFluidDependentState( Group & dataGroup, localIndex const targetIndex ) const;
+
   /**
    * @brief Get the number of fluid components (species)
    * @return the number of components
@@ -314,6 +346,9 @@ public:
     static constexpr auto phaseComponentFractionOldString  = "phaseComponentFractionOld";
     static constexpr auto porosityOldString                = "porosityOld";
 
+    // position of the diagonal block of each element in its rows of the local matrix
+    static constexpr auto diagonalBlockOffsetString        = "diagonalBlockOffset";
+
     // these are allocated on faces for BC application until we can get constitutive models on faces
     static constexpr auto phaseViscosityString             = "phaseViscosity";
     static constexpr auto phaseRelativePermeabilityString  = "phaseRelativePermeability";
@@ -408,6 +443,16 @@ private:
    */
   void ResetViews( MeshLevel & mesh ) override;
 
+  /**
+   * @brief Compute where the accumulation and flux Jacobian blocks go in the local matrix
+   * @param domain the domain containing the mesh and fields
+   * @param dofManager degree-of-freedom manager associated with the linear system
+   * @param localMatrix the local matrix, with its sparsity set
+   */
+  void SetupAssemblyMaps( DomainPartition & domain,
+                          DofManager const & dofManager,
+                          CRSMatrixView< real64 const, globalIndex const > const & localMatrix );
+
   /// the max number of fluid phases
   localIndex m_numPhases;
 
@@ -438,6 +483,9 @@ private:
   /// flag indicating whether local (cell-wise) chopping of negative compositions is allowed
   integer m_allowCompDensChopping;
 
+  /// position of the flux Jacobian blocks in the local matrix, for each stencil in the order of forAllStencils
+  std::vector< array3d< localIndex > > m_fluxAssemblyMaps;
+
 
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_pressure;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > > m_deltaPressure;
@@ -18,6 +18,12 @@
 
 #include "CompositionalMultiphaseFlowKernels.hpp"
 
+#include "codingUtilities/Utilities.hpp"
+#include "constitutive/fluid/MultiFluidPVTPackageWrapper.hpp"
+#include "constitutive/fluid/MultiPhaseMultiComponentFluid.hpp"
+#include "constitutive/relativePermeability/BrooksCoreyBakerRelativePermeability.hpp"
+#include "constitutive/relativePermeability/BrooksCoreyRelativePermeability.hpp"
+#include "constitutive/relativePermeability/VanGenuchtenBakerRelativePermeability.hpp"
 #include "finiteVolume/CellElementStencilTPFA.hpp"
 #include "finiteVolume/FaceElementStencil.hpp"
 
@@ -505,6 +511,232 @@ INST_PhaseMobilityKernel( 5, 3 );
 
 #undef INST_PhaseMobilityKernel
 
+/******************************** StateUpdateKernel ********************************/
+
+template< typename POLICY >
+template< localIndex NC, localIndex NP, typename FLUID_WRAPPER, typename RELPERM_WRAPPER >
+void
+StateUpdateKernel< POLICY >::
+  Launch( localIndex const size,
+          FLUID_WRAPPER const & fluidWrapper,
+          RELPERM_WRAPPER const & relPermWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          real64 const temp,
+          arrayView2d< real64 const > const & compDens,
+          arrayView2d< real64 const > const & dCompDens,
+          arrayView3d< real64 const > const & phaseFrac,
+          arrayView3d< real64 const > const & dPhaseFrac_dPres,
+          arrayView4d< real64 const > const & dPhaseFrac_dComp,
+          arrayView3d< real64 const > const & phaseDens,
+          arrayView3d< real64 const > const & dPhaseDens_dPres,
+          arrayView4d< real64 const > const & dPhaseDens_dComp,
+          arrayView3d< real64 const > const & phaseVisc,
+          arrayView3d< real64 const > const & dPhaseVisc_dPres,
+          arrayView4d< real64 const > const & dPhaseVisc_dComp,
+          arrayView3d< real64 const > const & phaseRelPerm,
+          arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac,
+          arrayView2d< real64 > const & compFrac,
+          arrayView3d< real64 > const & dCompFrac_dCompDens,
+          arrayView2d< real64 > const & phaseVolFrac,
+          arrayView2d< real64 > const & dPhaseVolFrac_dPres,
+          arrayView3d< real64 > const & dPhaseVolFrac_dComp,
+          arrayView2d< real64 > const & phaseMob,
+          arrayView2d< real64 > const & dPhaseMob_dPres,
+          arrayView3d< real64 > const & dPhaseMob_dComp )
+{
+  // read-only views of the values computed earlier in the pass
+  arrayView2d< real64 const > const & compFracConst = compFrac.toViewConst();
+  arrayView3d< real64 const > const & dCompFrac_dCompDensConst = dCompFrac_dCompDens.toViewConst();
+  arrayView2d< real64 const > const & phaseVolFracConst = phaseVolFrac.toViewConst();
+  arrayView2d< real64 const > const & dPhaseVolFrac_dPresConst = dPhaseVolFrac_dPres.toViewConst();
+  arrayView3d< real64 const > const & dPhaseVolFrac_dCompConst = dPhaseVolFrac_dComp.toViewConst();
+
+  forAll< POLICY >( size, [=] ( localIndex const k )
+  {
+    ComponentFractionKernel::Compute< NC >( compDens[k],
+                                            dCompDens[k],
+                                            compFrac[k],
+                                            dCompFrac_dCompDens[k] );
+
+    for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+    {
+      fluidWrapper.Update( k, q, pres[k] + dPres[k], temp, compFracConst[k] );
+    }
+
+    PhaseVolumeFractionKernel::Compute< NC, NP >( compDens[k],
+                                                  dCompDens[k],
+                                                  dCompFrac_dCompDensConst[k],
+                                                  phaseDens[k][0],
+                                                  dPhaseDens_dPres[k][0],
+                                                  dPhaseDens_dComp[k][0],
+                                                  phaseFrac[k][0],
+                                                  dPhaseFrac_dPres[k][0],
+                                                  dPhaseFrac_dComp[k][0],
+                                                  phaseVolFrac[k],
+                                                  dPhaseVolFrac_dPres[k],
+                                                  dPhaseVolFrac_dComp[k] );
+
+    for( localIndex q = 0; q < relPermWrapper.numGauss(); ++q )
+    {
+      relPermWrapper.Update( k, q, phaseVolFracConst[k] );
+    }
+
+    PhaseMobilityKernel::Compute< NC, NP >( dCompFrac_dCompDensConst[k],
+                                            phaseDens[k][0],
+                                            dPhaseDens_dPres[k][0],
+                                            dPhaseDens_dComp[k][0],
+                                            phaseVisc[k][0],
+                                            dPhaseVisc_dPres[k][0],
+                                            dPhaseVisc_dComp[k][0],
+                                            phaseRelPerm[k][0],
+                                            dPhaseRelPerm_dPhaseVolFrac[k][0],
+                                            dPhaseVolFrac_dPresConst[k],
+                                            dPhaseVolFrac_dCompConst[k],
+                                            phaseMob[k],
+                                            dPhaseMob_dPres[k],
+                                            dPhaseMob_dComp[k] );
+  } );
+}
+
+#define INST_StateUpdateKernel( NC, NP, FLUID, RELPERM ) \
+  template \
+  void StateUpdateKernel< FLUID::UpdatePolicy >:: \
+    Launch< NC, NP, FLUID::KernelWrapper, RELPERM::KernelWrapper >( localIndex const size, \
+          FLUID::KernelWrapper const & fluidWrapper, \
+          RELPERM::KernelWrapper const & relPermWrapper, \
+          arrayView1d< real64 const > const & pres, \
+          arrayView1d< real64 const > const & dPres, \
+          real64 const temp, \
+          arrayView2d< real64 const > const & compDens, \
+          arrayView2d< real64 const > const & dCompDens, \
+          arrayView3d< real64 const > const & phaseFrac, \
+          arrayView3d< real64 const > const & dPhaseFrac_dPres, \
+          arrayView4d< real64 const > const & dPhaseFrac_dComp, \
+          arrayView3d< real64 const > const & phaseDens, \
+          arrayView3d< real64 const > const & dPhaseDens_dPres, \
+          arrayView4d< real64 const > const & dPhaseDens_dComp, \
+          arrayView3d< real64 const > const & phaseVisc, \
+          arrayView3d< real64 const > const & dPhaseVisc_dPres, \
+          arrayView4d< real64 const > const & dPhaseVisc_dComp, \
+          arrayView3d< real64 const > const & phaseRelPerm, \
+          arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac, \
+          arrayView2d< real64 > const & compFrac, \
+          arrayView3d< real64 > const & dCompFrac_dCompDens, \
+          arrayView2d< real64 > const & phaseVolFrac, \
+          arrayView2d< real64 > const & dPhaseVolFrac_dPres, \
+          arrayView3d< real64 > const & dPhaseVolFrac_dComp, \
+          arrayView2d< real64 > const & phaseMob, \
+          arrayView2d< real64 > const & dPhaseMob_dPres, \
+          arrayView3d< real64 > const & dPhaseMob_dComp )
+
+#define INST_StateUpdateKernelModels( NC, NP ) \
+  INST_StateUpdateKernel( NC, NP, constitutive::MultiFluidPVTPackageWrapper, constitutive::BrooksCoreyRelativePermeability ); \
+  INST_StateUpdateKernel( NC, NP, constitutive::MultiFluidPVTPackageWrapper, constitutive::BrooksCoreyBakerRelativePermeability ); \
+  INST_StateUpdateKernel( NC, NP, constitutive::MultiFluidPVTPackageWrapper, constitutive::VanGenuchtenBakerRelativePermeability ); \
+  INST_StateUpdateKernel( NC, NP, constitutive::MultiPhaseMultiComponentFluid, constitutive::BrooksCoreyRelativePermeability ); \
+  INST_StateUpdateKernel( NC, NP, constitutive::MultiPhaseMultiComponentFluid, constitutive::BrooksCoreyBakerRelativePermeability ); \
+  INST_StateUpdateKernel( NC, NP, constitutive::MultiPhaseMultiComponentFluid, constitutive::VanGenuchtenBakerRelativePermeability )
+
+INST_StateUpdateKernelModels( 1, 2 );
+INST_StateUpdateKernelModels( 2, 2 );
+INST_StateUpdateKernelModels( 3, 2 );
+INST_StateUpdateKernelModels( 4, 2 );
+INST_StateUpdateKernelModels( 5, 2 );
+
+INST_StateUpdateKernelModels( 1, 3 );
+INST_StateUpdateKernelModels( 2, 3 );
+INST_StateUpdateKernelModels( 3, 3 );
+INST_StateUpdateKernelModels( 4, 3 );
+INST_StateUpdateKernelModels( 5, 3 );
+
+#undef INST_StateUpdateKernelModels
+#undef INST_StateUpdateKernel
+
+/******************************** AssemblyMapKernel ********************************/
+
+void
+AssemblyMapKernel::
+  Launch( localIndex const size,
+          globalIndex const rankOffset,
+          arrayView1d< globalIndex const > const & dofNumber,
+          arrayView1d< integer const > const & elemGhostRank,
+          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+          arrayView1d< localIndex > const & diagonalBlockOffset )
+{
+  forAll< parallelDevicePolicy<> >( size, [=] GEOSX_HOST_DEVICE ( localIndex const ei )
+  {
+    diagonalBlockOffset[ei] = -1;
+    if( elemGhostRank[ei] >= 0 )
+      return;
+
+    localIndex const localRow = LvArray::integerConversion< localIndex >( dofNumber[ei] - rankOffset );
+    diagonalBlockOffset[ei] = FindColumn( localMatrix, localRow, dofNumber[ei] );
+  } );
+}
+
+template< typename STENCIL_TYPE >
+void
+AssemblyMapKernel::
+  Launch( STENCIL_TYPE const & stencil,
+          globalIndex const rankOffset,
+          ElementView< arrayView1d< globalIndex const > > const & dofNumber,
+          ElementView< arrayView1d< integer const > > const & ghostRank,
+          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+          array3d< localIndex > & assemblyMap )
+{
+  typename STENCIL_TYPE::IndexContainerViewConstType const & seri = stencil.getElementRegionIndices();
+  typename STENCIL_TYPE::IndexContainerViewConstType const & sesri = stencil.getElementSubRegionIndices();
+  typename STENCIL_TYPE::IndexContainerViewConstType const & sei = stencil.getElementIndices();
+
+  localIndex constexpr NUM_ELEMS   = STENCIL_TYPE::NUM_POINT_IN_FLUX;
+  localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
+
+  assemblyMap.resizeWithoutInitializationOrDestruction( stencil.size(), NUM_ELEMS, MAX_STENCIL );
+  arrayView3d< localIndex > const & assemblyMapView = assemblyMap.toView();
+
+  forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
+  {
+    // same stencil size as in FluxKernel::Launch
+    localIndex const stencilSize = MAX_STENCIL;
+
+    for( localIndex i = 0; i < NUM_ELEMS; ++i )
+    {
+      for( localIndex j = 0; j < MAX_STENCIL; ++j )
+      {
+        assemblyMapView( iconn, i, j ) = -1;
+      }
+      if( ghostRank[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )] >= 0 )
+      {
+        continue;
+      }
+
+      globalIndex const globalRow = dofNumber[seri( iconn, i )][sesri( iconn, i )][sei( iconn, i )];
+      localIndex const localRow = LvArray::integerConversion< localIndex >( globalRow - rankOffset );
+      for( localIndex j = 0; j < stencilSize; ++j )
+      {
+        globalIndex const globalCol = dofNumber[seri( iconn, j )][sesri( iconn, j )][sei( iconn, j )];
+        assemblyMapView( iconn, i, j ) = FindColumn( localMatrix, localRow, globalCol );
+      }
+    }
+  } );
+}
+
+#define INST_AssemblyMapKernel( STENCIL_TYPE ) \
+  template \
+  void AssemblyMapKernel:: \
+    Launch< STENCIL_TYPE >( STENCIL_TYPE const & stencil, \
+                            globalIndex const rankOffset, \
+                            ElementView< arrayView1d< globalIndex const > > const & dofNumber, \
+                            ElementView< arrayView1d< integer const > > const & ghostRank, \
+                            CRSMatrixView< real64 const, globalIndex const > const & localMatrix, \
+                            array3d< localIndex > & assemblyMap )
+
+INST_AssemblyMapKernel( CellElementStencilTPFA );
+INST_AssemblyMapKernel( FaceElementStencil );
+
+#undef INST_AssemblyMapKernel
+
 /******************************** AccumulationKernel ********************************/
 
 template< localIndex NC >
@@ -567,6 +799,18 @@ AccumulationKernel::
   // sum contributions to component accumulation from each phase
   for( localIndex ip = 0; ip < NP; ++ip )
   {
+    // a phase absent at both time levels whose volume fraction does not change with the primary
+    // variables contributes exact zeros: skip it without reading its density and composition derivatives
+    bool phaseAbsent = phaseVolFrac[ip] <= 0.0 && phaseVolFracOld[ip] <= 0.0 && isZero( dPhaseVolFrac_dPres[ip], 0.0 );
+    for( localIndex jc = 0; jc < NC && phaseAbsent; ++jc )
+    {
+      phaseAbsent = isZero( dPhaseVolFrac_dCompDens[ip][jc], 0.0 );
+    }
+    if( phaseAbsent )
+    {
+      continue;
+    }
+
     real64 const phaseAmountNew = poreVolNew * phaseVolFrac[ip] * phaseDens[ip];
     real64 const phaseAmountOld = poreVolOld * phaseVolFracOld[ip] * phaseDensOld[ip];
 
@@ -637,6 +881,7 @@ AccumulationKernel::
           arrayView4d< real64 const > const & phaseCompFrac,
           arrayView4d< real64 const > const & dPhaseCompFrac_dPres,
           arrayView5d< real64 const > const & dPhaseCompFrac_dComp,
+          arrayView1d< localIndex const > const & diagonalBlockOffset,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
@@ -686,10 +931,11 @@ AccumulationKernel::
     for( localIndex i = 0; i < NC; ++i )
     {
       localRhs[localRow + i] += localAccum[i];
-      localMatrix.addToRow< serialAtomic >( localRow + i,
-                                            dofIndices,
-                                            localAccumJacobian[i],
-                                            NDOF );
+      AssemblyMapKernel::AddToBlock< serialAtomic, NDOF >( localMatrix,
+                                                           localRow + i,
+                                                           diagonalBlockOffset[ei],
+                                                           dofIndices,
+                                                           localAccumJacobian[i] );
     }
   } );
 }
@@ -721,6 +967,7 @@ AccumulationKernel::
                   arrayView4d< real64 const > const & phaseCompFrac, \
                   arrayView4d< real64 const > const & dPhaseCompFrac_dPres, \
                   arrayView5d< real64 const > const & dPhaseCompFrac_dComp, \
+                  arrayView1d< localIndex const > const & diagonalBlockOffset, \
                   CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                   arrayView1d< real64 > const & localRhs )
 
@@ -777,6 +1024,18 @@ FluxKernel::
   // loop over phases, compute and upwind phase flux and sum contributions to each component's flux
   for( localIndex ip = 0; ip < NP; ++ip )
   {
+    // the phase flux is skipped below if the phase is immobile upstream; when it is immobile in all
+    // connected cells, skip it before reading any density or capillary pressure derivatives
+    bool phaseImmobile = true;
+    for( localIndex i = 0; i < NUM_ELEMS && phaseImmobile; ++i )
+    {
+      phaseImmobile = std::fabs( phaseMob[seri[i]][sesri[i]][sei[i]][ip] ) < 1e-20;
+    }
+    if( phaseImmobile )
+    {
+      continue;
+    }
+
     // clear working arrays
     real64 densMean{};
     real64 dDensMean_dP[NUM_ELEMS]{};
@@ -1031,6 +1290,7 @@ FluxKernel::
           ElementView< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac,
           integer const capPressureFlag,
           real64 const dt,
+          arrayView3d< localIndex const > const & assemblyMap,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs )
 {
@@ -1043,6 +1303,9 @@ FluxKernel::
   localIndex constexpr MAX_STENCIL = STENCIL_TYPE::MAX_STENCIL_SIZE;
   localIndex constexpr NDOF = NC + 1;
 
+  // the map is missing if the stencil changed since it was computed
+  bool const useAssemblyMap = assemblyMap.size( 0 ) == stencil.size();
+
   forAll< parallelDevicePolicy<> >( stencil.size(), [=] GEOSX_HOST_DEVICE ( localIndex const iconn )
   {
     // TODO: hack! for MPFA, etc. must obtain proper size from e.g. seri
@@ -1106,10 +1369,25 @@ FluxKernel::
         for( localIndex ic = 0; ic < NC; ++ic )
         {
           RAJA::atomicAdd( parallelDeviceAtomic{}, &localRhs[localRow + ic], localFlux[i * NC + ic] );
-          localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
-                                                                            dofColIndices,
-                                                                            localFluxJacobian[i * NC + ic].dataIfContiguous(),
-                                                                            stencilSize * NDOF );
+          if( useAssemblyMap )
+          {
+            real64 const * const localFluxJacobianRow = localFluxJacobian[i * NC + ic].dataIfContiguous();
+            for( localIndex j = 0; j < stencilSize; ++j )
+            {
+              AssemblyMapKernel::AddToBlock< parallelDeviceAtomic, NDOF >( localMatrix,
+                                                                           localRow + ic,
+                                                                           assemblyMap( iconn, i, j ),
+                                                                           &dofColIndices[j * NDOF],
+                                                                           &localFluxJacobianRow[j * NDOF] );
+            }
+          }
+          else
+          {
+            localMatrix.addToRowBinarySearchUnsorted< parallelDeviceAtomic >( localRow + ic,
+                                                                              dofColIndices,
+                                                                              localFluxJacobian[i * NC + ic].dataIfContiguous(),
+                                                                              stencilSize * NDOF );
+          }
         }
       }
     }
@@ -1143,6 +1421,7 @@ FluxKernel::
                                 ElementView< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac, \
                                 integer const capPressureFlag, \
                                 real64 const dt, \
+                                arrayView3d< localIndex const > const & assemblyMap, \
                                 CRSMatrixView< real64, globalIndex const > const & localMatrix, \
                                 arrayView1d< real64 > const & localRhs )
 
@@ -331,6 +331,179 @@ struct CapillaryPressureUpdateKernel
   }
 };
 
+/******************************** StateUpdateKernel ********************************/
+
+/**
+ * @brief Fused update of the fluid state and of the properties that depend on it
+ * @tparam POLICY the launch policy, the one of the fluid model since it is updated in the same pass
+ *
+ * For each cell, the component fractions, the fluid properties, the phase volume fractions,
+ * the relative permeabilities and the phase mobilities are computed in a single pass, so that
+ * the derivatives of a cell are reused while they are in cache instead of being streamed
+ * through memory again by a separate kernel for each property.
+ */
+template< typename POLICY >
+struct StateUpdateKernel
+{
+  template< localIndex NC, localIndex NP, typename FLUID_WRAPPER, typename RELPERM_WRAPPER >
+  static void
+  Launch( localIndex const size,
+          FLUID_WRAPPER const & fluidWrapper,
+          RELPERM_WRAPPER const & relPermWrapper,
+          arrayView1d< real64 const > const & pres,
+          arrayView1d< real64 const > const & dPres,
+          real64 const temp,
+          arrayView2d< real64 const > const & compDens,
+          arrayView2d< real64 const > const & dCompDens,
+          arrayView3d< real64 const > const & phaseFrac,
+          arrayView3d< real64 const > const & dPhaseFrac_dPres,
+          arrayView4d< real64 const > const & dPhaseFrac_dComp,
+          arrayView3d< real64 const > const & phaseDens,
+          arrayView3d< real64 const > const & dPhaseDens_dPres,
+          arrayView4d< real64 const > const & dPhaseDens_dComp,
+          arrayView3d< real64 const > const & phaseVisc,
+          arrayView3d< real64 const > const & dPhaseVisc_dPres,
+          arrayView4d< real64 const > const & dPhaseVisc_dComp,
+          arrayView3d< real64 const > const & phaseRelPerm,
+          arrayView4d< real64 const > const & dPhaseRelPerm_dPhaseVolFrac,
+          arrayView2d< real64 > const & compFrac,
+          arrayView3d< real64 > const & dCompFrac_dCompDens,
+          arrayView2d< real64 > const & phaseVolFrac,
+          arrayView2d< real64 > const & dPhaseVolFrac_dPres,
+          arrayView3d< real64 > const & dPhaseVolFrac_dComp,
+          arrayView2d< real64 > const & phaseMob,
+          arrayView2d< real64 > const & dPhaseMob_dPres,
+          arrayView3d< real64 > const & dPhaseMob_dComp );
+};
+
+/******************************** AssemblyMapKernel ********************************/
+
+/**
+ * @brief Functions to precompute where the Jacobian blocks are assembled in the local matrix
+ *
+ * The sparsity of the local matrix is fixed between two calls to SetupSystem, so the position
+ * of each block in the rows of the CSR matrix is found once, and the assembly kernels add
+ * their values directly at that position instead of searching the columns of the row at
+ * every Newton iteration. The positions are relative to the beginning of the row, and the
+ * rows of an element share the same columns, so one position is stored per block of rows.
+ */
+struct AssemblyMapKernel
+{
+  /**
+   * @brief The type for element-based data. Consists entirely of ArrayView's.
+   */
+  template< typename VIEWTYPE >
+  using ElementView = typename ElementRegionManager::ElementViewAccessor< VIEWTYPE >::ViewTypeConst;
+
+  /**
+   * @brief Find a column in a row of the local matrix.
+   * @param localMatrix the local matrix
+   * @param row the local row
+   * @param col the global column index
+   * @return the position of @p col in @p row, or -1 if it is not in the sparsity pattern
+   */
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static localIndex
+  FindColumn( CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+              localIndex const row,
+              globalIndex const col )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+    localIndex first = 0;
+    localIndex last = localMatrix.numNonZeros( row );
+    while( first < last )
+    {
+      localIndex const mid = first + ( last - first ) / 2;
+      if( columns[mid] < col )
+      {
+        first = mid + 1;
+      }
+      else
+      {
+        last = mid;
+      }
+    }
+    return ( first < localMatrix.numNonZeros( row ) && columns[first] == col ) ? first : -1;
+  }
+
+  /**
+   * @brief Add a block of values to consecutive columns of a row of the local matrix.
+   * @tparam POLICY the atomic policy
+   * @tparam N the number of columns in the block
+   * @param localMatrix the local matrix
+   * @param row the local row
+   * @param pos the precomputed position of the first column of the block in @p row
+   * @param cols the N consecutive global column indices
+   * @param values the N values to add
+   *
+   * The position is checked against the columns of the row, if it is out of date (e.g. the
+   * matrix was set up by a coupled solver) the columns are searched for as usual.
+   */
+  template< typename POLICY, localIndex N >
+  GEOSX_HOST_DEVICE
+  GEOSX_FORCE_INLINE
+  static void
+  AddToBlock( CRSMatrixView< real64, globalIndex const > const & localMatrix,
+              localIndex const row,
+              localIndex const pos,
+              globalIndex const * const cols,
+              real64 const * const values )
+  {
+    arraySlice1d< globalIndex const > const columns = localMatrix.getColumns( row );
+    if( pos >= 0 && pos + N <= localMatrix.numNonZeros( row ) &&
+        columns[pos] == cols[0] && columns[pos + N - 1] == cols[N - 1] )
+    {
+      arraySlice1d< real64 > const entries = localMatrix.getEntries( row );
+      for( localIndex j = 0; j < N; ++j )
+      {
+        RAJA::atomicAdd( POLICY{}, &entries[pos + j], values[j] );
+      }
+    }
+    else
+    {
+      localMatrix.addToRowBinarySearchUnsorted< POLICY >( row, cols, values, N );
+    }
+  }
+
+  /**
+   * @brief Compute the position of the diagonal block of each element.
+   * @param size the number of elements
+   * @param rankOffset the offset of this rank in the global numbering
+   * @param dofNumber the first degree of freedom of each element
+   * @param elemGhostRank the ghost rank of each element
+   * @param localMatrix the local matrix, with its sparsity set
+   * @param diagonalBlockOffset the position of the diagonal block in the rows of each element
+   */
+  static void
+  Launch( localIndex const size,
+          globalIndex const rankOffset,
+          arrayView1d< globalIndex const > const & dofNumber,
+          arrayView1d< integer const > const & elemGhostRank,
+          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+          arrayView1d< localIndex > const & diagonalBlockOffset );
+
+  /**
+   * @brief Compute the position of the blocks of each stencil connection.
+   * @tparam STENCIL_TYPE the type of stencil
+   * @param stencil the stencil
+   * @param rankOffset the offset of this rank in the global numbering
+   * @param dofNumber the first degree of freedom of each element
+   * @param ghostRank the ghost rank of each element
+   * @param localMatrix the local matrix, with its sparsity set
+   * @param assemblyMap the position of the block of the j-th element of each connection
+   *                    in the rows of its i-th element, with i and j the last two indices
+   */
+  template< typename STENCIL_TYPE >
+  static void
+  Launch( STENCIL_TYPE const & stencil,
+          globalIndex const rankOffset,
+          ElementView< arrayView1d< globalIndex const > > const & dofNumber,
+          ElementView< arrayView1d< integer const > > const & ghostRank,
+          CRSMatrixView< real64 const, globalIndex const > const & localMatrix,
+          array3d< localIndex > & assemblyMap );
+};
+
 /******************************** AccumulationKernel ********************************/
 
 /**
@@ -389,6 +562,7 @@ struct AccumulationKernel
           arrayView4d< real64 const > const & phaseCompFrac,
           arrayView4d< real64 const > const & dPhaseCompFrac_dPres,
           arrayView5d< real64 const > const & dPhaseCompFrac_dComp,
+          arrayView1d< localIndex const > const & diagonalBlockOffset,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 };
@@ -468,6 +642,7 @@ struct FluxKernel
           ElementView< arrayView4d< real64 const > > const & dPhaseCapPressure_dPhaseVolFrac,
           integer const capPressureFlag,
           real64 const dt,
+          arrayView3d< localIndex const > const & assemblyMap,
           CRSMatrixView< real64, globalIndex const > const & localMatrix,
           arrayView1d< real64 > const & localRhs );
 };
@@ -22,6 +22,8 @@
 #include "finiteVolume/FluxApproximationBase.hpp"
 #include "managers/DomainPartition.hpp"
 #include "managers/NumericalMethodsManager.hpp"
+#include "mpiCommunications/CommunicationTools.hpp"
+#include "mpiCommunications/NeighborCommunicator.hpp"
 
 namespace geosx
 {
@@ -45,7 +47,8 @@ FlowSolverBase::FlowSolverBase( std::string const & name,
   m_porosityRef(),
   m_elementArea(),
   m_elementAperture0(),
-  m_elementAperture()
+  m_elementAperture(),
+  m_syncPlan( std::make_unique< SynchronizationPlan >( true ) )
 {
   this->registerWrapper( viewKeyStruct::discretizationString, &m_discretizationName )->
     setInputFlag( InputFlags::REQUIRED )->
@@ -256,6 +259,70 @@ void FlowSolverBase::ResetViews( MeshLevel & mesh )
     FaceElementSubRegion::viewKeyStruct::dSeparationCoeffdAperString );
   m_element_dSeparationCoefficient_dAperture.setName( getName() + "/accessors/" + FaceElementSubRegion::viewKeyStruct::dSeparationCoeffdAperString );
 #endif
+
+  // Split the elements of each target subregion into locally owned elements, which do not need
+  // ghost values to be updated, and ghost elements, which are overwritten by synchronization
+  m_ownedElems.clear();
+  m_ghostElems.clear();
+  m_ownedElems.resize( elemManager.numRegions() );
+  m_ghostElems.resize( elemManager.numRegions() );
+  forTargetSubRegionsComplete( mesh, [&]( localIndex const,
+                                          localIndex const er,
+                                          localIndex const esr,
+                                          ElementRegionBase const & region,
+                                          ElementSubRegionBase const & subRegion )
+  {
+    m_ownedElems[er].resize( region.numSubRegions() );
+    m_ghostElems[er].resize( region.numSubRegions() );
+
+    SortedArray< localIndex > & ownedElems = m_ownedElems[er][esr];
+    SortedArray< localIndex > & ghostElems = m_ghostElems[er][esr];
+
+    arrayView1d< integer const > const & ghostRank = subRegion.ghostRank();
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      if( ghostRank[ei] < 0 )
+      {
+        ownedElems.insert( ei );
+      }
+      else
+      {
+        ghostElems.insert( ei );
+      }
+    }
+  } );
+}
+
+void FlowSolverBase::SynchronizeFieldsWithOverlap( std::map< string, string_array > const & fieldNames,
+                                                   DomainPartition & domain,
+                                                   ElementSetUpdate const & update )
+{
+  GEOSX_MARK_FUNCTION;
+
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+  std::vector< NeighborCommunicator > & neighbors = domain.getNeighbors();
+
+  CommunicationTools::SynchronizePackSendRecv( fieldNames, &mesh, neighbors, *m_syncPlan, true );
+
+  forTargetSubRegionsComplete( mesh, [&]( localIndex const targetIndex,
+                                          localIndex const er,
+                                          localIndex const esr,
+                                          ElementRegionBase &,
+                                          ElementSubRegionBase & subRegion )
+  {
+    update( targetIndex, subRegion, m_ownedElems[er][esr].toViewConst() );
+  } );
+
+  CommunicationTools::SynchronizeUnpack( &mesh, neighbors, *m_syncPlan, true );
+
+  forTargetSubRegionsComplete( mesh, [&]( localIndex const targetIndex,
+                                          localIndex const er,
+                                          localIndex const esr,
+                                          ElementRegionBase &,
+                                          ElementSubRegionBase & subRegion )
+  {
+    update( targetIndex, subRegion, m_ghostElems[er][esr].toViewConst() );
+  } );
 }
 
 std::vector< string > FlowSolverBase::getConstitutiveRelations( string const & regionName ) const
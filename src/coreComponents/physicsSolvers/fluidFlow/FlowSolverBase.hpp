@@ -30,6 +30,8 @@ class Group;
 }
 class FieldSpecificationBase;
 class DomainPartition;
+class ElementSubRegionBase;
+class SynchronizationPlan;
 
 /**
  * @class FlowSolverBase
@@ -150,6 +152,24 @@ protected:
 
   virtual void InitializePostInitialConditions_PreSubGroups( Group * const rootGroup ) override;
 
+  /// Type of the function applied to a subset of the elements of a target subregion
+  using ElementSetUpdate = std::function< void ( localIndex const targetIndex,
+                                                 ElementSubRegionBase & subRegion,
+                                                 SortedArrayView< localIndex const > const & elems ) >;
+
+  /**
+   * @brief Synchronize element fields with the neighbors, overlapping the exchange with local work
+   * @param fieldNames the names of the fields to synchronize, keyed by object type
+   * @param domain the domain partition
+   * @param update the update applied to the locally owned elements of each target subregion while
+   *               ghost values are in flight, then to the ghost elements once they have been received
+   *
+   * The update must only depend on values of the element it is applied to.
+   */
+  void SynchronizeFieldsWithOverlap( std::map< string, string_array > const & fieldNames,
+                                     DomainPartition & domain,
+                                     ElementSetUpdate const & update );
+
   /// name of the fluid constitutive model
   array1d< string > m_fluidModelNames;
 
@@ -182,6 +202,15 @@ protected:
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > >  m_elementAperture;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 const > >  m_effectiveAperture;
 
+  /// locally owned elements of each target subregion, indexed by region and subregion
+  array1d< array1d< SortedArray< localIndex > > > m_ownedElems;
+
+  /// ghost elements of each target subregion, indexed by region and subregion
+  array1d< array1d< SortedArray< localIndex > > > m_ghostElems;
+
+  /// cached buffers and persistent requests for the synchronization in SynchronizeFieldsWithOverlap
+  std::unique_ptr< SynchronizationPlan > m_syncPlan;
+
 #ifdef GEOSX_USE_SEPARATION_COEFFICIENT
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > >  m_elementSeparationCoefficient;
   ElementRegionManager::ElementViewAccessor< arrayView1d< real64 > >  m_element_dSeparationCoefficient_dAperture;
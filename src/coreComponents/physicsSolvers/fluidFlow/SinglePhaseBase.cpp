@@ -167,6 +167,24 @@ void SinglePhaseBase::UpdateFluidModel( Group & dataGroup, localIndex const targ
   } );
 }
 
+void SinglePhaseBase::UpdateFluidModel( Group & dataGroup,
+                                        localIndex const targetIndex,
+                                        SortedArrayView< localIndex const > const & targetSet ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const & pres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+  arrayView1d< real64 const > const & dPres = dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+  SingleFluidBase & fluid = GetConstitutiveModel< SingleFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    FluidUpdateKernel::Launch( targetSet, fluidWrapper, pres, dPres );
+  } );
+}
+
 void SinglePhaseBase::UpdateSolidModel( Group & dataGroup, localIndex const targetIndex ) const
 {
   GEOSX_MARK_FUNCTION;
@@ -291,6 +291,15 @@ protected:
    */
   virtual void UpdateFluidModel( Group & dataGroup, localIndex const targetIndex ) const;
 
+  /**
+   * @brief Function to update the fluid model on a subset of elements
+   * @param dataGroup group that contains the fields
+   * @param targetSet the elements to update
+   */
+  virtual void UpdateFluidModel( Group & dataGroup,
+                                 localIndex const targetIndex,
+                                 SortedArrayView< localIndex const > const & targetSet ) const;
+
   /**
    * @brief Function to update all constitutive models
    * @param dataGroup group that contains the fields
@@ -383,6 +383,22 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  template< typename FLUID_WRAPPER >
+  static void Launch( SortedArrayView< localIndex const > const & targetSet,
+                      FLUID_WRAPPER const & fluidWrapper,
+                      arrayView1d< real64 const > const & pres,
+                      arrayView1d< real64 const > const & dPres )
+  {
+    forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const k = targetSet[ i ];
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.Update( k, q, pres[k] + dPres[k] );
+      }
+    } );
+  }
 };
 
 /******************************** ResidualNormKernel ********************************/
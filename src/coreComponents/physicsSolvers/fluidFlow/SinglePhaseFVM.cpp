@@ -18,7 +18,6 @@
 
 #include "SinglePhaseFVM.hpp"
 
-#include "mpiCommunications/CommunicationTools.hpp"
 #include "common/TimingMacros.hpp"
 #include "constitutive/fluid/singleFluidSelector.hpp"
 #include "managers/NumericalMethodsManager.hpp"
@@ -194,11 +193,18 @@ void SinglePhaseFVM< BASE >::ApplySystemSolution( DofManager const & dofManager,
   std::map< string, string_array > fieldNames;
   fieldNames["elems"].emplace_back( string( viewKeyStruct::deltaPressureString ) );
 
-  CommunicationTools::SynchronizeFields( fieldNames, &mesh, domain.getNeighbors(), true );
+  // update the fluid on owned elements while ghost pressures are in flight
+  this->SynchronizeFieldsWithOverlap( fieldNames, domain, [&]( localIndex const targetIndex,
+                                                               ElementSubRegionBase & subRegion,
+                                                               SortedArrayView< localIndex const > const & elems )
+  {
+    this->UpdateFluidModel( subRegion, targetIndex, elems );
+  } );
 
   forTargetSubRegions( mesh, [&] ( localIndex const targetIndex, ElementSubRegionBase & subRegion )
   {
-    this->UpdateState( subRegion, targetIndex );
+    this->UpdateSolidModel( subRegion, targetIndex );
+    this->UpdateMobility( subRegion, targetIndex );
   } );
 }
 
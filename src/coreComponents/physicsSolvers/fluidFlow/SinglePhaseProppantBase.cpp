@@ -105,6 +105,50 @@ void SinglePhaseProppantBase::UpdateFluidModel( Group & dataGroup, localIndex co
   } );
 }
 
+void SinglePhaseProppantBase::UpdateFluidModel( Group & dataGroup,
+                                                localIndex const targetIndex,
+                                                SortedArrayView< localIndex const > const & targetSet ) const
+{
+  GEOSX_MARK_FUNCTION;
+
+  arrayView1d< real64 const > const & pres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::pressureString );
+
+  arrayView1d< real64 const > const & dPres =
+    dataGroup.getReference< array1d< real64 > >( viewKeyStruct::deltaPressureString );
+
+  arrayView1d< real64 const > const & proppantConcentration =
+    dataGroup.getReference< array1d< real64 > >( ProppantTransport::viewKeyStruct::proppantConcentrationString );
+
+  arrayView1d< real64 const > const & dProppantConcentration =
+    dataGroup.getReference< array1d< real64 > >( ProppantTransport::viewKeyStruct::deltaProppantConcentrationString );
+
+  arrayView2d< real64 const > const & componentConcentration =
+    dataGroup.getReference< array2d< real64 > >( ProppantTransport::viewKeyStruct::componentConcentrationString );
+
+  arrayView1d< R1Tensor const > const & cellBasedFlux =
+    dataGroup.getReference< array1d< R1Tensor > >( ProppantTransport::viewKeyStruct::cellBasedFluxString );
+
+  arrayView1d< integer const > const & isProppantBoundaryElement =
+    dataGroup.getReference< array1d< integer > >( ProppantTransport::viewKeyStruct::isProppantBoundaryString );
+
+  SlurryFluidBase & fluid = GetConstitutiveModel< SlurryFluidBase >( dataGroup, m_fluidModelNames[targetIndex] );
+
+  constitutive::constitutiveUpdatePassThru( fluid, [&]( auto & castedFluid )
+  {
+    typename TYPEOFREF( castedFluid ) ::KernelWrapper fluidWrapper = castedFluid.createKernelWrapper();
+    SinglePhaseProppantBaseKernels::FluidUpdateKernel::Launch( targetSet,
+                                                               fluidWrapper,
+                                                               pres,
+                                                               dPres,
+                                                               proppantConcentration,
+                                                               dProppantConcentration,
+                                                               componentConcentration,
+                                                               cellBasedFlux,
+                                                               isProppantBoundaryElement );
+  } );
+}
+
 void SinglePhaseProppantBase::ResetViewsPrivate( ElementRegionManager const & elemManager )
 {
   m_density.clear();
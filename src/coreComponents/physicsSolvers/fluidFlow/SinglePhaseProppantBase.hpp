@@ -56,6 +56,10 @@ public:
 
   virtual void UpdateFluidModel( Group & dataGroup, localIndex const targetIndex ) const override;
 
+  virtual void UpdateFluidModel( Group & dataGroup,
+                                 localIndex const targetIndex,
+                                 SortedArrayView< localIndex const > const & targetSet ) const override;
+
 protected:
 
   virtual void ValidateFluidModels( DomainPartition const & domain ) const override;
@@ -54,6 +54,32 @@ struct FluidUpdateKernel
       }
     } );
   }
+
+  template< typename FLUID_WRAPPER >
+  static void Launch( SortedArrayView< localIndex const > const & targetSet,
+                      FLUID_WRAPPER const & fluidWrapper,
+                      arrayView1d< real64 const > const & pres,
+                      arrayView1d< real64 const > const & dPres,
+                      arrayView1d< real64 const > const & proppantConcentration,
+                      arrayView1d< real64 const > const & dProppantConcentration,
+                      arrayView2d< real64 const > const & componentConcentration,
+                      arrayView1d< R1Tensor const > const & cellBasedFlux,
+                      arrayView1d< integer const > const & isProppantBoundaryElement )
+  {
+    forAll< parallelDevicePolicy<> >( targetSet.size(), [=] GEOSX_HOST_DEVICE ( localIndex const i )
+    {
+      localIndex const a = targetSet[ i ];
+      for( localIndex q = 0; q < fluidWrapper.numGauss(); ++q )
+      {
+        fluidWrapper.Update( a, q,
+                             pres[a] + dPres[a],
+                             proppantConcentration[a] + dProppantConcentration[a],
+                             componentConcentration[a],
+                             cellBasedFlux[a].L2_Norm(),
+                             isProppantBoundaryElement[a] );
+      }
+    } );
+  }
 };
 
 } //namespace SinglePhaseProppantBaseKernels
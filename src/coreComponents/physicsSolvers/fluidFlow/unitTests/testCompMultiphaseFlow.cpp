@@ -494,6 +494,88 @@ void testPhaseMobilityNumericalDerivatives( CompositionalMultiphaseFlow & solver
   } );
 }
 
+void testFusedStateUpdate( CompositionalMultiphaseFlow & solver,
+                           DomainPartition & domain )
+{
+  MeshLevel & mesh = *domain.getMeshBody( 0 )->getMeshLevel( 0 );
+
+  string const fieldNames[] = { CompositionalMultiphaseFlow::viewKeyStruct::globalCompFractionString,
+                                CompositionalMultiphaseFlow::viewKeyStruct::phaseVolumeFractionString,
+                                CompositionalMultiphaseFlow::viewKeyStruct::dPhaseVolumeFraction_dPressureString,
+                                CompositionalMultiphaseFlow::viewKeyStruct::phaseMobilityString,
+                                CompositionalMultiphaseFlow::viewKeyStruct::dPhaseMobility_dPressureString };
+
+  string const derivFieldNames[] = { CompositionalMultiphaseFlow::viewKeyStruct::dGlobalCompFraction_dGlobalCompDensityString,
+                                     CompositionalMultiphaseFlow::viewKeyStruct::dPhaseVolumeFraction_dGlobalCompDensityString,
+                                     CompositionalMultiphaseFlow::viewKeyStruct::dPhaseMobility_dGlobalCompDensityString };
+
+  solver.forTargetSubRegions( mesh, [&]( localIndex const targetIndex,
+                                         ElementSubRegionBase & subRegion )
+  {
+    SCOPED_TRACE( subRegion.getParent()->getName() + "/" + subRegion.getName() );
+
+    arrayView1d< real64 > const & dPres =
+      subRegion.getReference< array1d< real64 > >( CompositionalMultiphaseFlow::viewKeyStruct::deltaPressureString );
+
+    arrayView2d< real64 > const & dCompDens =
+      subRegion.getReference< array2d< real64 > >( CompositionalMultiphaseFlow::viewKeyStruct::deltaGlobalCompDensityString );
+
+    arrayView2d< real64 const > const & compDens =
+      subRegion.getReference< array2d< real64 > >( CompositionalMultiphaseFlow::viewKeyStruct::globalCompDensityString );
+
+    // move away from the initial state so that every cell is different
+    solver.ResetStateToBeginningOfStep( domain );
+    for( localIndex ei = 0; ei < subRegion.size(); ++ei )
+    {
+      dPres[ei] = 1e5 * ( ei + 1 );
+      for( localIndex ic = 0; ic < dCompDens.size( 1 ); ++ic )
+      {
+        dCompDens[ei][ic] = 1e-2 * ( ic + 1 ) * ( ei + 1 ) * compDens[ei][ic];
+      }
+    }
+
+    // fused update (whichever path the fluid model selects)
+    solver.UpdateState( subRegion, targetIndex );
+
+    std::vector< array2d< real64 > > fields;
+    for( string const & name : fieldNames )
+    {
+      fields.emplace_back( subRegion.getReference< array2d< real64 > >( name ) );
+    }
+    std::vector< array3d< real64 > > derivFields;
+    for( string const & name : derivFieldNames )
+    {
+      derivFields.emplace_back( subRegion.getReference< array3d< real64 > >( name ) );
+    }
+
+    // separate updates
+    solver.UpdateComponentFraction( subRegion );
+    solver.UpdateFluidModel( subRegion, targetIndex );
+    solver.UpdateFluidDependentState( subRegion, targetIndex );
+
+    for( std::size_t i = 0; i < fields.size(); ++i )
+    {
+      SCOPED_TRACE( fieldNames[i] );
+      arrayView2d< real64 const > const & field = subRegion.getReference< array2d< real64 > >( fieldNames[i] );
+      ASSERT_EQ( field.size(), fields[i].size() );
+      for( localIndex k = 0; k < field.size(); ++k )
+      {
+        EXPECT_DOUBLE_EQ( field.data()[k], fields[i].data()[k] );
+      }
+    }
+    for( std::size_t i = 0; i < derivFields.size(); ++i )
+    {
+      SCOPED_TRACE( derivFieldNames[i] );
+      arrayView3d< real64 const > const & field = subRegion.getReference< array3d< real64 > >( derivFieldNames[i] );
+      ASSERT_EQ( field.size(), derivFields[i].size() );
+      for( localIndex k = 0; k < field.size(); ++k )
+      {
+        EXPECT_DOUBLE_EQ( field.data()[k], derivFields[i].data()[k] );
+      }
+    }
+  } );
+}
+
 template< typename LAMBDA >
 void testNumericalJacobian( CompositionalMultiphaseFlow & solver,
                             DomainPartition & domain,
@@ -690,6 +772,12 @@ TEST_F( CompositionalMultiphaseFlowTest, derivativeNumericalCheck_phaseMobility
   testPhaseMobilityNumericalDerivatives( *solver, domain, perturb, tol );
 }
 
+TEST_F( CompositionalMultiphaseFlowTest, fusedStateUpdate )
+{
+  DomainPartition & domain = *problemManager->getDomainPartition();
+  testFusedStateUpdate( *solver, domain );
+}
+
 /*
  * Accumulation numerical test not passing due to some numerical catastrophic cancellation
  * happenning in the kernel for the particular set of initial conditions we're running.
@@ -387,6 +387,8 @@ void PoroelasticSolver::AssembleCouplingTerms( DomainPartition const & domain,
     SolidBase const & solid = GetConstitutiveModel< SolidBase >( elementSubRegion, solidName );
 
     arrayView4d< real64 const > const & dNdX = elementSubRegion.dNdX();
+    GEOSX_ERROR_IF( dNdX.size( 0 ) != elementSubRegion.size(),
+                    "The coupling assembly needs stored shape function derivatives, which are not kept when building with ENABLE_FE_GRADIENTS_ON_THE_FLY" );
 
     arrayView2d< real64 const > const & detJ = elementSubRegion.detJ();
 
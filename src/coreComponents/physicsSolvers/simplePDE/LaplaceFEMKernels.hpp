@@ -183,6 +183,7 @@ public:
           inputMatrix,
           inputRhs ),
     m_primaryField( nodeManager.template getReference< array1d< real64 > >( fieldName )),
+    m_X( nodeManager.referencePosition()),
     m_dNdX( elementSubRegion.dNdX() ),
     m_detJ( elementSubRegion.detJ() )
   {}
@@ -204,11 +205,16 @@ public:
     GEOSX_HOST_DEVICE
     StackVariables():
       Base::StackVariables(),
-            primaryField_local{ 0.0 }
+            primaryField_local{ 0.0 },
+            xLocal()
     {}
 
     /// C-array storage for the element local primary field variable.
     real64 primaryField_local[numNodesPerElem];
+
+    /// C-array storage for the element local reference position, only filled
+    /// when the shape function derivatives are computed in the kernel.
+    real64 xLocal[numNodesPerElem][3];
   };
 
 
@@ -232,6 +238,12 @@ public:
       stack.primaryField_local[ a ] = m_primaryField[ localNodeIndex ];
       stack.localRowDofIndex[a] = m_dofNumber[localNodeIndex];
       stack.localColDofIndex[a] = m_dofNumber[localNodeIndex];
+#if defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
+      for( int i=0; i<3; ++i )
+      {
+        stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+      }
+#endif
     }
   }
 
@@ -244,11 +256,13 @@ public:
                                             localIndex const q,
                                             StackVariables & stack ) const
   {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    finiteElement::FiniteElementBase::getShapeFunctionDerivatives< FE_TYPE >( k, q, stack.xLocal, m_dNdX, dNdX );
     for( localIndex a=0; a<numNodesPerElem; ++a )
     {
       for( localIndex b=0; b<numNodesPerElem; ++b )
       {
-        stack.localJacobian[ a ][ b ] += LvArray::tensorOps::AiBi< 3 >( m_dNdX[k][q][a], m_dNdX[k][q][b] ) * m_detJ( k, q );
+        stack.localJacobian[ a ][ b ] += LvArray::tensorOps::AiBi< 3 >( dNdX[a], dNdX[b] ) * m_detJ( k, q );
       }
     }
   }
@@ -298,7 +312,11 @@ protected:
   /// The global primary field array.
   arrayView1d< real64 const > const m_primaryField;
 
-  /// The global shape function derivatives array.
+  /// The global reference position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The global shape function derivatives array, empty when they are
+  /// computed in the kernel.
   arrayView4d< real64 const > const m_dNdX;
 
   /// The global determinant of the parent/physical Jacobian.
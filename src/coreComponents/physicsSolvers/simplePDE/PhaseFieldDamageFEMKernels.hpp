@@ -110,6 +110,7 @@ public:
           inputMatrix,
           inputRhs ),
     m_nodalDamage( nodeManager.template getReference< array1d< real64 > >( fieldName )),
+    m_X( nodeManager.referencePosition()),
     m_dNdX( elementSubRegion.dNdX() ),
     m_detJ( elementSubRegion.detJ() ),
     m_Gc( Gc ),
@@ -134,11 +135,16 @@ public:
     GEOSX_HOST_DEVICE
     StackVariables():
       Base::StackVariables(),
-            nodalDamageLocal{ 0.0 }
+            nodalDamageLocal{ 0.0 },
+            xLocal()
     {}
 
     /// C-array storage for the element local primary field variable.
     real64 nodalDamageLocal[numNodesPerElem];
+
+    /// C-array storage for the element local reference position, only filled
+    /// when the shape function derivatives are computed in the kernel.
+    real64 xLocal[numNodesPerElem][3];
   };
 
 
@@ -162,6 +168,12 @@ public:
       stack.nodalDamageLocal[ a ] = m_nodalDamage[ localNodeIndex ];
       stack.localRowDofIndex[a] = m_dofNumber[localNodeIndex];
       stack.localColDofIndex[a] = m_dofNumber[localNodeIndex];
+#if defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
+      for( int i=0; i<3; ++i )
+      {
+        stack.xLocal[ a ][ i ] = m_X[ localNodeIndex ][ i ];
+      }
+#endif
     }
   }
 
@@ -174,6 +186,8 @@ public:
                                             localIndex const q,
                                             StackVariables & stack ) const
   {
+    real64 dNdX[ numNodesPerElem ][ 3 ];
+    finiteElement::FiniteElementBase::getShapeFunctionDerivatives< FE_TYPE >( k, q, stack.xLocal, m_dNdX, dNdX );
 
     real64 const strainEnergyDensity = m_constitutiveUpdate.calculateStrainEnergyDensity( k, q );
 //    std::cout<<k<<", "<<q<<", "<< strainEnergyDensity<<std::endl;
@@ -197,7 +211,7 @@ public:
     for( localIndex a = 0; a < numNodesPerElem; ++a )
     {
       qp_damage += N[a] * stack.nodalDamageLocal[a];
-      temp = m_dNdX[k][q][a];
+      temp = R1Tensor( dNdX[a][0], dNdX[a][1], dNdX[a][2] );
       temp *= stack.nodalDamageLocal[a];
       qp_grad_damage += temp;
     }
@@ -207,14 +221,14 @@ public:
       if( m_localDissipationOption == 1 )
       {
         stack.localResidual[ a ] += m_detJ[k][q] * ( N[a] * (m_lengthScale * D - 3 * m_Gc / 16 )/ m_Gc -
-                                                     0.375*pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( qp_grad_damage, m_dNdX[k][q][a] ) -
+                                                     0.375*pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( qp_grad_damage, dNdX[a] ) -
                                                      m_lengthScale * D/m_Gc * N[a] * qp_damage
                                                      );
       }
       else
       {
         stack.localResidual[ a ] += m_detJ[k][q] * ( N[a] * (2 * m_lengthScale) * strainEnergyDensity / m_Gc -
-                                                     ( pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( qp_grad_damage, m_dNdX[k][q][a] ) +
+                                                     ( pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( qp_grad_damage, dNdX[a] ) +
                                                        N[a] * qp_damage * (1 + 2 * m_lengthScale*strainEnergyDensity/m_Gc)
                                                      )
                                                      );
@@ -224,13 +238,13 @@ public:
         if( m_localDissipationOption == 1 )
         {
           stack.localJacobian[ a ][ b ] -= m_detJ[k][q] *
-                                           (0.375*pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( m_dNdX[k][q][a], m_dNdX[k][q][b] ) +
+                                           (0.375*pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( dNdX[a], dNdX[b] ) +
                                             (m_lengthScale * D/m_Gc) * N[a] * N[b]);
         }
         else
         {
           stack.localJacobian[ a ][ b ] -= m_detJ[k][q] *
-                                           ( pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( m_dNdX[k][q][a], m_dNdX[k][q][b] ) +
+                                           ( pow( m_lengthScale, 2 ) * LvArray::tensorOps::AiBi< 3 >( dNdX[a], dNdX[b] ) +
                                              N[a] * N[b] * (1 + 2 * m_lengthScale*strainEnergyDensity/m_Gc )
                                            );
         }
@@ -275,7 +289,11 @@ protected:
   /// The global primary field array.
   arrayView1d< real64 const > const m_nodalDamage;
 
-  /// The global shape function derivatives array.
+  /// The global reference position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The global shape function derivatives array, empty when they are
+  /// computed in the kernel.
   arrayView4d< real64 const > const m_dNdX;
 
   /// The global determinant of the parent/physical Jacobian.
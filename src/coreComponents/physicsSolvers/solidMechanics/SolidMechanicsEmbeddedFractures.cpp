@@ -379,6 +379,8 @@ void SolidMechanicsEmbeddedFractures::AssembleSystem( real64 const time,
 
           // Basis functions derivatives
           arrayView4d< real64 const > const & dNdX = elementSubRegion->dNdX();
+          GEOSX_ERROR_IF( dNdX.size( 0 ) != elementSubRegion->size(),
+                          "The embedded fracture assembly needs stored shape function derivatives, which are not kept when building with ENABLE_FE_GRADIENTS_ON_THE_FLY" );
 
           // transformation determinant
           arrayView2d< real64 const > const & detJ = elementSubRegion->detJ();
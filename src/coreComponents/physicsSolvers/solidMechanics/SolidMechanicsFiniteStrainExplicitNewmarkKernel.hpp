@@ -28,7 +28,7 @@ namespace geosx
 namespace SolidMechanicsLagrangianFEMKernels
 {
 
-#if defined(GEOSX_USE_CUDA)
+#if defined(GEOSX_USE_CUDA) || defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
 /// Macro variable to indicate whether or not to calculate the shape function
 /// derivatives in the kernel instead of using a pre-calculated value.
 #define CALCFEMSHAPE
@@ -131,7 +131,8 @@ public:
                         FE_TYPE const & finiteElementSpace,
                         CONSTITUTIVE_TYPE * const inputConstitutiveType,
                         real64 const dt,
-                        string const & elementListName ):
+                        string const & elementListName,
+                        string const & elementColorsName ):
     Base( nodeManager,
           edgeManager,
           faceManager,
@@ -139,7 +140,8 @@ public:
           finiteElementSpace,
           inputConstitutiveType,
           dt,
-          elementListName )
+          elementListName,
+          elementColorsName )
   {}
 
 
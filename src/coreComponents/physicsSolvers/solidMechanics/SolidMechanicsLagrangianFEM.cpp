@@ -57,11 +57,13 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
   m_maxForce( 0.0 ),
   m_maxNumResolves( 10 ),
   m_strainTheory( 0 ),
+  m_elementColoring( 0 ),
+  m_elementBatching( 0 ),
 //  m_elemsAttachedToSendOrReceiveNodes(),
 //  m_elemsNotAttachedToSendOrReceiveNodes(),
   m_sendOrReceiveNodes(),
   m_nonSendOrReceiveNodes(),
-  m_iComm(),
+  m_syncPlan( true ),
   m_effectiveStress( 0 )
 {
   m_sendOrReceiveNodes.setName( "SolidMechanicsLagrangianFEM::m_sendOrReceiveNodes" );
@@ -116,6 +118,19 @@ SolidMechanicsLagrangianFEM::SolidMechanicsLagrangianFEM( const std::string & na
                     " 0 - Infinitesimal Strain \n"
                     " 1 - Finite Strain" );
 
+  registerWrapper( viewKeyStruct::elementColoringString, &m_elementColoring )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to launch the explicit kernels over groups of elements that share no node, "
+                    "so that the nodal forces are assembled without atomic operations." );
+
+  registerWrapper( viewKeyStruct::elementBatchingString, &m_elementBatching )->
+    setApplyDefaultValue( 0 )->
+    setInputFlag( InputFlags::OPTIONAL )->
+    setDescription( "Flag to launch the implicit assembly kernels over batches of consecutive elements, "
+                    "so that the quadrature point work is vectorized across elements. "
+                    "Only available in host builds." );
+
   registerWrapper( viewKeyStruct::solidMaterialNamesString, &m_solidMaterialNames )->
     setInputFlag( InputFlags::REQUIRED )->
     setDescription( "The name of the material that should be used in the constitutive updates" );
@@ -142,6 +157,11 @@ void SolidMechanicsLagrangianFEM::PostProcessInput()
 
   CheckModelNames( m_solidMaterialNames, viewKeyStruct::solidMaterialNamesString );
 
+#if defined( GEOSX_USE_CUDA )
+  GEOSX_ERROR_IF( m_elementBatching != 0,
+                  getName() << ": " << viewKeyStruct::elementBatchingString << " is not available in device builds" );
+#endif
+
   LinearSolverParameters & linParams = m_linearSolverParameters.get();
   linParams.isSymmetric = true;
   linParams.dofsPerNode = 3;
@@ -230,6 +250,14 @@ void SolidMechanicsLagrangianFEM::RegisterDataOnMesh( Group * const MeshBodies )
       subRegion.registerWrapper< SortedArray< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes )->
         setPlotLevel( PlotLevel::NOPLOT )->
         setRestartFlags( RestartFlags::NO_WRITE );
+
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsAttachedToSendOrReceiveNodesColors )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE );
+
+      subRegion.registerWrapper< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColors )->
+        setPlotLevel( PlotLevel::NOPLOT )->
+        setRestartFlags( RestartFlags::NO_WRITE );
     } );
 
   }
@@ -451,6 +479,18 @@ void SolidMechanicsLagrangianFEM::InitializePostInitialConditions_PreSubGroups(
           }
         }
       } );
+
+      if( m_elementColoring )
+      {
+        finiteElement::colorElements( elemsToNodes,
+                                      elemsAttachedToSendOrReceiveNodes.toViewConst(),
+                                      nodes.size(),
+                                      getElemsAttachedToSendOrReceiveNodesColors( elementSubRegion ) );
+        finiteElement::colorElements( elemsToNodes,
+                                      elemsNotAttachedToSendOrReceiveNodes.toViewConst(),
+                                      nodes.size(),
+                                      getElemsNotAttachedToSendOrReceiveNodesColors( elementSubRegion ) );
+      }
     } );
   } );
 }
@@ -552,8 +592,6 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
   fieldNames["node"].emplace_back( keys::Velocity );
   fieldNames["node"].emplace_back( keys::Acceleration );
 
-  CommunicationTools::SynchronizePackSendRecvSizes( fieldNames, &mesh, domain.getNeighbors(), m_iComm, true );
-
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Acceleration );
 
   //3: v^{n+1/2} = v^{n} + a^{n} dt/2
@@ -598,28 +636,30 @@ real64 SolidMechanicsLagrangianFEM::ExplicitStep( real64 const & time_n,
                           this->getDiscretizationName(),
                           m_solidMaterialNames,
                           dt,
-                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodes ) );
+                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodes ),
+                          string( viewKeyStruct::elemsAttachedToSendOrReceiveNodesColors ) );
 
   // apply this over a set
   SolidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_sendOrReceiveNodes.toViewConst() );
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Velocity );
 
-  CommunicationTools::SynchronizePackSendRecv( fieldNames, &mesh, domain.getNeighbors(), m_iComm, true );
+  CommunicationTools::SynchronizePackSendRecv( fieldNames, &mesh, domain.getNeighbors(), m_syncPlan, true );
 
   explicitKernelDispatch( mesh,
                           targetRegionNames(),
                           this->getDiscretizationName(),
                           m_solidMaterialNames,
                           dt,
-                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes ) );
+                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes ),
+                          string( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColors ) );
 
   // apply this over a set
   SolidMechanicsLagrangianFEMKernels::velocityUpdate( acc, mass, vel, dt / 2, m_nonSendOrReceiveNodes.toViewConst() );
 
   fsManager.ApplyFieldValue< parallelDevicePolicy< 1024 > >( time_n, &domain, "nodeManager", keys::Velocity );
 
-  CommunicationTools::SynchronizeUnpack( &mesh, domain.getNeighbors(), m_iComm, true );
+  CommunicationTools::SynchronizeUnpack( &mesh, domain.getNeighbors(), m_syncPlan, true );
 
   return dt;
 }
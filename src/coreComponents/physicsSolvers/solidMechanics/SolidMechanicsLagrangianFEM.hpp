@@ -233,6 +233,10 @@ public:
     static constexpr auto maxForce = "maxForce";
     static constexpr auto elemsAttachedToSendOrReceiveNodes = "elemsAttachedToSendOrReceiveNodes";
     static constexpr auto elemsNotAttachedToSendOrReceiveNodes = "elemsNotAttachedToSendOrReceiveNodes";
+    static constexpr auto elemsAttachedToSendOrReceiveNodesColors = "elemsAttachedToSendOrReceiveNodesColors";
+    static constexpr auto elemsNotAttachedToSendOrReceiveNodesColors = "elemsNotAttachedToSendOrReceiveNodesColors";
+    static constexpr auto elementColoringString = "elementColoring";
+    static constexpr auto elementBatchingString = "elementBatching";
     static constexpr auto effectiveStress = "effectiveStress";
 
     dataRepository::ViewKey vTilde = { vTildeString };
@@ -260,6 +264,16 @@ public:
     return subRegion.getReference< SortedArray< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodes );
   }
 
+  ArrayOfArrays< localIndex > & getElemsAttachedToSendOrReceiveNodesColors( ElementSubRegionBase & subRegion )
+  {
+    return subRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsAttachedToSendOrReceiveNodesColors );
+  }
+
+  ArrayOfArrays< localIndex > & getElemsNotAttachedToSendOrReceiveNodesColors( ElementSubRegionBase & subRegion )
+  {
+    return subRegion.getReference< ArrayOfArrays< localIndex > >( viewKeyStruct::elemsNotAttachedToSendOrReceiveNodesColors );
+  }
+
   void setEffectiveStress( integer const input )
   {
     m_effectiveStress = input;
@@ -282,11 +296,17 @@ protected:
   real64 m_maxForce = 0.0;
   integer m_maxNumResolves;
   integer m_strainTheory;
+
+  /// Whether the explicit kernels launch the elements by color to scatter the nodal forces without atomics
+  integer m_elementColoring;
+
+  /// Whether the implicit assembly kernels are launched over batches of elements, see finiteElement::ElementBatchPolicy
+  integer m_elementBatching;
   array1d< string > m_solidMaterialNames;
   string m_contactRelationName;
   SortedArray< localIndex > m_sendOrReceiveNodes;
   SortedArray< localIndex > m_nonSendOrReceiveNodes;
-  MPI_iCommData m_iComm;
+  SynchronizationPlan m_syncPlan;
 
   /// Indicates whether or not to use effective stress when integrating the
   /// stress divergence in the kernels. This means calling the poroelastic
@@ -329,20 +349,43 @@ void SolidMechanicsLagrangianFEM::AssemblyLaunch( DomainPartition & domain,
                                         gravityVector().Data()[1],
                                         gravityVector().Data()[2] };
 
-  m_maxForce = finiteElement::
-                 regionBasedKernelApplication< parallelDevicePolicy< 32 >,
-                                               CONSTITUTIVE_BASE,
-                                               CellElementSubRegion,
-                                               KERNEL_TEMPLATE >( mesh,
-                                                                  targetRegionNames(),
-                                                                  this->getDiscretizationName(),
-                                                                  m_solidMaterialNames,
-                                                                  dofNumber,
-                                                                  dofManager.rankOffset(),
-                                                                  localMatrix,
-                                                                  localRhs,
-                                                                  gravityVectorData,
-                                                                  std::forward< PARAMS >( params )... );
+#if !defined( GEOSX_USE_CUDA )
+  if( m_elementBatching )
+  {
+    // 8 elements per batch fills the SIMD lanes of the hexahedral quadrature point loops
+    m_maxForce = finiteElement::
+                   regionBasedKernelApplication< finiteElement::ElementBatchPolicy< parallelHostPolicy, 8 >,
+                                                 CONSTITUTIVE_BASE,
+                                                 CellElementSubRegion,
+                                                 KERNEL_TEMPLATE >( mesh,
+                                                                    targetRegionNames(),
+                                                                    this->getDiscretizationName(),
+                                                                    m_solidMaterialNames,
+                                                                    dofNumber,
+                                                                    dofManager.rankOffset(),
+                                                                    localMatrix,
+                                                                    localRhs,
+                                                                    gravityVectorData,
+                                                                    std::forward< PARAMS >( params )... );
+  }
+  else
+#endif
+  {
+    m_maxForce = finiteElement::
+                   regionBasedKernelApplication< parallelDevicePolicy< 32 >,
+                                                 CONSTITUTIVE_BASE,
+                                                 CellElementSubRegion,
+                                                 KERNEL_TEMPLATE >( mesh,
+                                                                    targetRegionNames(),
+                                                                    this->getDiscretizationName(),
+                                                                    m_solidMaterialNames,
+                                                                    dofNumber,
+                                                                    dofManager.rankOffset(),
+                                                                    localMatrix,
+                                                                    localRhs,
+                                                                    gravityVectorData,
+                                                                    std::forward< PARAMS >( params )... );
+  }
 
 
   ApplyContactConstraint( dofManager,
@@ -29,7 +29,7 @@ namespace geosx
 namespace SolidMechanicsLagrangianFEMKernels
 {
 
-#if defined(GEOSX_USE_CUDA)
+#if defined(GEOSX_USE_CUDA) || defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
 /// Macro variable to indicate whether or not to calculate the shape function
 /// derivatives in the kernel instead of using a pre-calculated value.
 #define CALCFEMSHAPE
@@ -99,6 +99,9 @@ public:
    * @param dt The time interval for the step.
    * @param elementListName The name of the entry that holds the list of
    *   elements to be processed during this kernel launch.
+   * @param elementColorsName The name of the entry that holds the coloring of
+   *   the element list (see finiteElement::colorElements()). If it is empty, the
+   *   element list is processed directly and the forces are scattered with atomics.
    */
   ExplicitSmallStrain( NodeManager & nodeManager,
                        EdgeManager const & edgeManager,
@@ -107,7 +110,8 @@ public:
                        FE_TYPE const & finiteElementSpace,
                        CONSTITUTIVE_TYPE * const inputConstitutiveType,
                        real64 const dt,
-                       string const & elementListName ):
+                       string const & elementListName,
+                       string const & elementColorsName ):
     Base( elementSubRegion,
           finiteElementSpace,
           inputConstitutiveType ),
@@ -120,7 +124,9 @@ public:
     m_vel( nodeManager.velocity()),
     m_acc( nodeManager.acceleration() ),
     m_dt( dt ),
-    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() )
+    m_elementList( elementSubRegion.template getReference< SortedArray< localIndex > >( elementListName ).toViewConst() ),
+    m_elementsByColor( elementSubRegion.template getReference< ArrayOfArrays< localIndex > >( elementColorsName ).toViewConst() ),
+    m_conflictFreeScatter( m_elementsByColor.size() > 0 )
   {
     GEOSX_UNUSED_VAR( edgeManager );
     GEOSX_UNUSED_VAR( faceManager );
@@ -269,6 +275,8 @@ public:
    *
    * ### ExplicitSmallStrain Description
    * Performs the distribution of the nodal force out to the rank local arrays.
+   * When the elements are launched by color, no other element of the launch
+   * shares a node with element @p k, and the force is added without atomics.
    */
   GEOSX_HOST_DEVICE
   GEOSX_FORCE_INLINE
@@ -278,9 +286,19 @@ public:
     for( localIndex a = 0; a < numNodesPerElem; ++a )
     {
       localIndex const nodeIndex = m_elemsToNodes( k, a );
-      for( int b = 0; b < numDofPerTestSupportPoint; ++b )
+      if( m_conflictFreeScatter )
       {
-        RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        for( int b = 0; b < numDofPerTestSupportPoint; ++b )
+        {
+          m_acc( nodeIndex, b ) += stack.fLocal[ a ][ b ];
+        }
+      }
+      else
+      {
+        for( int b = 0; b < numDofPerTestSupportPoint; ++b )
+        {
+          RAJA::atomicAdd< parallelDeviceAtomic >( &m_acc( nodeIndex, b ), stack.fLocal[ a ][ b ] );
+        }
       }
     }
     return 0;
@@ -291,7 +309,8 @@ public:
    *
    * ### ExplicitSmallStrain Description
    * Copy of the KernelBase::kernelLaunch function without the exclusion of ghost
-   * elements.
+   * elements. If the element list is colored, the colors are launched one after
+   * the other so that complete() may scatter without atomics.
    */
   template< typename POLICY,
             typename KERNEL_TYPE >
@@ -303,12 +322,8 @@ public:
 
     GEOSX_UNUSED_VAR( numElems );
 
-    localIndex const numProcElems = kernelComponent.m_elementList.size();
-    forAll< POLICY >( numProcElems,
-                      [=] GEOSX_DEVICE ( localIndex const index )
+    auto kernel = [=] GEOSX_HOST_DEVICE ( localIndex const k )
     {
-      localIndex const k = kernelComponent.m_elementList[ index ];
-
       typename KERNEL_TYPE::StackVariables stack;
 
       kernelComponent.setup( k, stack );
@@ -321,7 +336,21 @@ public:
         kernelComponent.quadraturePointResidualContribution( k, q, stack );
       }
       kernelComponent.complete( k, stack );
-    } );
+    };
+
+    if( kernelComponent.m_conflictFreeScatter )
+    {
+      finiteElement::forAllElementColors< POLICY >( kernelComponent.m_elementsByColor, kernel );
+    }
+    else
+    {
+      SortedArrayView< localIndex const > const & elementList = kernelComponent.m_elementList;
+      forAll< POLICY >( elementList.size(),
+                        [=] GEOSX_DEVICE ( localIndex const index )
+      {
+        kernel( elementList[ index ] );
+      } );
+    }
     return 0;
   }
 
@@ -352,6 +381,12 @@ protected:
   /// The list of elements to process for the kernel launch.
   SortedArrayView< localIndex const > const m_elementList;
 
+  /// The elements of m_elementList split into colors that share no node.
+  ArrayOfArraysView< localIndex const > const m_elementsByColor;
+
+  /// Whether the elements are launched by color, allowing the scatter without atomics.
+  bool const m_conflictFreeScatter;
+
 
 };
 #undef CALCFEMSHAPE
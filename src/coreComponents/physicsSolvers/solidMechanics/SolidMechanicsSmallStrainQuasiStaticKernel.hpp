@@ -110,6 +110,7 @@ public:
           inputRhs ),
     m_disp( nodeManager.totalDisplacement()),
     m_uhat( nodeManager.incrementalDisplacement()),
+    m_X( nodeManager.referencePosition()),
     m_dNdX( elementSubRegion.dNdX() ),
     m_detJ( elementSubRegion.detJ() ),
     m_gravityVector{ inputGravityVector[0], inputGravityVector[1], inputGravityVector[2] },
@@ -135,6 +136,8 @@ public:
       Base::StackVariables(),
                                        u_local(),
                                        uhat_local(),
+                                       xLocal(),
+                                       dNdX{ {0.0} },
                                        constitutiveStiffness{ {0.0} }
     {}
 
@@ -144,6 +147,13 @@ public:
     /// Stack storage for the element local nodal incremental displacement
     real64 uhat_local[numNodesPerElem][numDofPerTrialSupportPoint];
 
+    /// Stack storage for the element local nodal reference position, only
+    /// filled when the shape function derivatives are computed in the kernel.
+    real64 xLocal[numNodesPerElem][3];
+
+    /// Stack storage for the shape function derivatives at a quadrature point.
+    real64 dNdX[numNodesPerElem][3];
+
     /// Stack storage for the constitutive stiffness at a quadrature point.
     real64 constitutiveStiffness[ 6 ][ 6 ];
   };
@@ -170,6 +180,9 @@ public:
       {
         stack.u_local[ a ][i] = m_disp[ localNodeIndex ][i];
         stack.uhat_local[ a ][i] = m_uhat[ localNodeIndex ][i];
+#if defined(GEOSX_USE_FE_GRADIENTS_ON_THE_FLY)
+        stack.xLocal[ a ][i] = m_X[ localNodeIndex ][i];
+#endif
         stack.localRowDofIndex[a*3+i] = m_dofNumber[localNodeIndex]+i;
         stack.localColDofIndex[a*3+i] = m_dofNumber[localNodeIndex]+i;
       }
@@ -190,20 +203,22 @@ public:
                                    localIndex const q,
                                    StackVariables & stack ) const
   {
+    finiteElement::FiniteElementBase::getShapeFunctionDerivatives< FE_TYPE >( k, q, stack.xLocal, m_dNdX, stack.dNdX );
+
     real64 strainInc[6] = {0};
     for( localIndex a = 0; a < numNodesPerElem; ++a )
     {
-      strainInc[0] = strainInc[0] + m_dNdX( k, q, a, 0 ) * stack.uhat_local[a][0];
-      strainInc[1] = strainInc[1] + m_dNdX( k, q, a, 1 ) * stack.uhat_local[a][1];
-      strainInc[2] = strainInc[2] + m_dNdX( k, q, a, 2 ) * stack.uhat_local[a][2];
-      strainInc[3] = strainInc[3] + m_dNdX( k, q, a, 2 ) * stack.uhat_local[a][1] +
-                     m_dNdX( k, q, a, 1 ) * stack.uhat_local[a][2];
+      strainInc[0] = strainInc[0] + stack.dNdX[ a ][ 0 ] * stack.uhat_local[a][0];
+      strainInc[1] = strainInc[1] + stack.dNdX[ a ][ 1 ] * stack.uhat_local[a][1];
+      strainInc[2] = strainInc[2] + stack.dNdX[ a ][ 2 ] * stack.uhat_local[a][2];
+      strainInc[3] = strainInc[3] + stack.dNdX[ a ][ 2 ] * stack.uhat_local[a][1] +
+                     stack.dNdX[ a ][ 1 ] * stack.uhat_local[a][2];
 
-      strainInc[4] = strainInc[4] + m_dNdX( k, q, a, 2 ) * stack.uhat_local[a][0] +
-                     m_dNdX( k, q, a, 0 ) * stack.uhat_local[a][2];
+      strainInc[4] = strainInc[4] + stack.dNdX[ a ][ 2 ] * stack.uhat_local[a][0] +
+                     stack.dNdX[ a ][ 0 ] * stack.uhat_local[a][2];
 
-      strainInc[5] = strainInc[5] + m_dNdX( k, q, a, 1 ) * stack.uhat_local[a][0] +
-                     m_dNdX( k, q, a, 0 ) * stack.uhat_local[a][1];
+      strainInc[5] = strainInc[5] + stack.dNdX[ a ][ 1 ] * stack.uhat_local[a][0] +
+                     stack.dNdX[ a ][ 0 ] * stack.uhat_local[a][1];
     }
 
     m_constitutiveUpdate.SmallStrain( k, q, strainInc );
@@ -266,35 +281,35 @@ public:
       for( localIndex b=0; b<numNodesPerElem; ++b )
       {
         real64 const (&c)[6][6] = stack.constitutiveStiffness;
-        stack.localJacobian[ a*3+0 ][ b*3+0 ] -= ( c[0][0]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[5][5]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 1 ) +
-                                                   c[4][4]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+0 ][ b*3+0 ] -= ( c[0][0]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[5][5]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 1 ] +
+                                                   c[4][4]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+0 ][ b*3+1 ] -= ( c[5][5]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[0][1]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 1 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+0 ][ b*3+1 ] -= ( c[5][5]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[0][1]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 1 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+0 ][ b*3+2 ] -= ( c[4][4]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[0][2]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+0 ][ b*3+2 ] -= ( c[4][4]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[0][2]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+1 ][ b*3+1 ] -= ( c[5][5]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[1][1]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 1 ) +
-                                                   c[3][3]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+1 ][ b*3+1 ] -= ( c[5][5]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[1][1]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 1 ] +
+                                                   c[3][3]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+1 ][ b*3+0 ] -= ( c[0][1]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[5][5]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 1 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+1 ][ b*3+0 ] -= ( c[0][1]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[5][5]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 1 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+1 ][ b*3+2 ] -= ( c[3][3]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 1 ) +
-                                                   c[1][2]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+1 ][ b*3+2 ] -= ( c[3][3]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 1 ] +
+                                                   c[1][2]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+2 ][ b*3+0 ] -= ( c[0][2]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[4][4]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+2 ][ b*3+0 ] -= ( c[0][2]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[4][4]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+2 ][ b*3+1 ] -= ( c[1][2]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 1 ) +
-                                                   c[3][3]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+2 ][ b*3+1 ] -= ( c[1][2]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 1 ] +
+                                                   c[3][3]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
-        stack.localJacobian[ a*3+2 ][ b*3+2 ] -= ( c[4][4]*m_dNdX( k, q, a, 0 )*m_dNdX( k, q, b, 0 ) +
-                                                   c[3][3]*m_dNdX( k, q, a, 1 )*m_dNdX( k, q, b, 1 ) +
-                                                   c[2][2]*m_dNdX( k, q, a, 2 )*m_dNdX( k, q, b, 2 ) ) * m_detJ( k, q );
+        stack.localJacobian[ a*3+2 ][ b*3+2 ] -= ( c[4][4]*stack.dNdX[ a ][ 0 ]*stack.dNdX[ b ][ 0 ] +
+                                                   c[3][3]*stack.dNdX[ a ][ 1 ]*stack.dNdX[ b ][ 1 ] +
+                                                   c[2][2]*stack.dNdX[ a ][ 2 ]*stack.dNdX[ b ][ 2 ] ) * m_detJ( k, q );
 
         dynamicsTerms( a, b );
       }
@@ -332,17 +347,17 @@ public:
     FE_TYPE::shapeFunctionValues( q, N );
     for( localIndex a = 0; a < numNodesPerElem; ++a )
     {
-      stack.localResidual[ a * 3 + 0 ] -= ( stress[ 0 ] * m_dNdX( k, q, a, 0 ) +
-                                            stress[ 5 ] * m_dNdX( k, q, a, 1 ) +
-                                            stress[ 4 ] * m_dNdX( k, q, a, 2 ) -
+      stack.localResidual[ a * 3 + 0 ] -= ( stress[ 0 ] * stack.dNdX[ a ][ 0 ] +
+                                            stress[ 5 ] * stack.dNdX[ a ][ 1 ] +
+                                            stress[ 4 ] * stack.dNdX[ a ][ 2 ] -
                                             gravityForce[0] * N[a] ) * m_detJ( k, q );
-      stack.localResidual[ a * 3 + 1 ] -= ( stress[ 5 ] * m_dNdX( k, q, a, 0 ) +
-                                            stress[ 1 ] * m_dNdX( k, q, a, 1 ) +
-                                            stress[ 3 ] * m_dNdX( k, q, a, 2 ) -
+      stack.localResidual[ a * 3 + 1 ] -= ( stress[ 5 ] * stack.dNdX[ a ][ 0 ] +
+                                            stress[ 1 ] * stack.dNdX[ a ][ 1 ] +
+                                            stress[ 3 ] * stack.dNdX[ a ][ 2 ] -
                                             gravityForce[1] * N[a] ) * m_detJ( k, q );
-      stack.localResidual[ a * 3 + 2 ] -= ( stress[ 4 ] * m_dNdX( k, q, a, 0 ) +
-                                            stress[ 3 ] * m_dNdX( k, q, a, 1 ) +
-                                            stress[ 2 ] * m_dNdX( k, q, a, 2 ) -
+      stack.localResidual[ a * 3 + 2 ] -= ( stress[ 4 ] * stack.dNdX[ a ][ 0 ] +
+                                            stress[ 3 ] * stack.dNdX[ a ][ 1 ] +
+                                            stress[ 2 ] * stack.dNdX[ a ][ 2 ] -
                                             gravityForce[2] * N[a] ) * m_detJ( k, q );
     }
   }
@@ -387,7 +402,11 @@ protected:
   /// The rank-global incremental displacement array.
   arrayView2d< real64 const, nodes::INCR_DISPLACEMENT_USD > const m_uhat;
 
-  /// The shape function derivative for each quadrature point.
+  /// The rank-global reference position array.
+  arrayView2d< real64 const, nodes::REFERENCE_POSITION_USD > const m_X;
+
+  /// The shape function derivative for each quadrature point, empty when they
+  /// are computed in the kernel.
   arrayView4d< real64 const > const m_dNdX;
 
   /// The parent->physical jacobian determinant for each quadrature point.
@@ -464,6 +464,12 @@ real64 SurfaceGenerator::SolverStep( real64 const & time_n,
                                0,
                                time_n + dt );
     }
+
+    // the epoch has to change on all ranks, as the neighbors of a split also rebuild their synchronizations
+    if( MpiWrapper::Max( rval, MPI_COMM_GEOSX ) > 0 )
+    {
+      meshLevel.incrementTopologyEpoch();
+    }
   }
 
   NumericalMethodsManager & numericalMethodManager = domain.getNumericalMethodManager();
@@ -516,8 +522,8 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
   FaceManager & faceManager = *mesh.getFaceManager();
   ElementRegionManager & elementManager = *mesh.getElemManager();
 
-  std::vector< std::set< localIndex > > nodesToRupturedFaces;
-  std::vector< std::set< localIndex > > edgesToRupturedFaces;
+  ArrayOfSets< localIndex > nodesToRupturedFaces;
+  ArrayOfSets< localIndex > edgesToRupturedFaces;
 
   ArrayOfArraysView< localIndex > const & nodeToElementMap = nodeManager.elementList().toView();
   ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
@@ -572,6 +578,28 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
 
   const arrayView1d< integer > & isNodeGhost = nodeManager.ghostRank();
 
+  // A node can only split if it is owned, shared by several elements and
+  // touches a ruptured face. Flag these nodes in parallel so that the serial
+  // loop below only calls ProcessNode on them. Splitting only changes the
+  // first two conditions, which are checked again in the loop.
+  localIndex const numNodesBeforeSplit = nodeManager.size();
+  array1d< integer > splitCandidates( numNodesBeforeSplit );
+  {
+    arrayView1d< integer > const & splitCandidatesView = splitCandidates.toView();
+    arrayView1d< integer const > const & ghostRank = nodeManager.ghostRank().toViewConst();
+    arrayView1d< localIndex const > const & parentNodeIndices = nodeManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
+    ArrayOfArraysView< localIndex const > const & nodeToElements = nodeManager.elementList().toViewConst();
+    ArrayOfSetsView< localIndex const > const & nodesToRupturedFacesView = nodesToRupturedFaces.toViewConst();
+
+    forAll< parallelHostPolicy >( numNodesBeforeSplit, [=]( localIndex const a )
+    {
+      localIndex const parentNodeIndex = ObjectManagerBase::GetParentRecusive( parentNodeIndices, a );
+      splitCandidatesView[a] = ghostRank[a] < 0 &&
+                               nodeToElements.sizeOfArray( a ) > 1 &&
+                               nodesToRupturedFacesView.sizeOfSet( parentNodeIndex ) > 0;
+    } );
+  }
+
   for( int color=0; color<numTileColors; ++color )
   {
     ModifiedObjectLists modifiedObjects;
@@ -580,8 +608,10 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
       for( localIndex a=0; a<nodeManager.size(); ++a )
       {
         int didSplit = 0;
+        // nodes created by a split in this loop were not part of the candidate search.
         if( isNodeGhost[a]<0 &&
-            nodeToElementMap.sizeOfArray( a )>1 )
+            nodeToElementMap.sizeOfArray( a )>1 &&
+            ( a >= numNodesBeforeSplit || splitCandidates[a] ) )
         {
           didSplit += ProcessNode( a,
                                    time_np1,
@@ -589,8 +619,8 @@ int SurfaceGenerator::SeparationDriver( DomainPartition & domain,
                                    edgeManager,
                                    faceManager,
                                    elementManager,
-                                   nodesToRupturedFaces,
-                                   edgesToRupturedFaces,
+                                   nodesToRupturedFaces.toViewConst(),
+                                   edgesToRupturedFaces.toViewConst(),
                                    elementManager,
                                    modifiedObjects, prefrac );
           if( didSplit > 0 )
@@ -864,8 +894,8 @@ bool SurfaceGenerator::ProcessNode( const localIndex nodeID,
                                     EdgeManager & edgeManager,
                                     FaceManager & faceManager,
                                     ElementRegionManager & elemManager,
-                                    std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                    std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                    ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                                    ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                                     ElementRegionManager & elementManager,
                                     ModifiedObjectLists & modifiedObjects,
                                     const bool GEOSX_UNUSED_PARAM( prefrac ) )
@@ -925,8 +955,8 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
                                            const EdgeManager & edgeManager,
                                            const FaceManager & faceManager,
                                            ElementRegionManager & elemManager,
-                                           const std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                           const std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                                           ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                                           ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                                            std::set< localIndex > & separationPathFaces,
                                            map< localIndex, int > & edgeLocations,
                                            map< localIndex, int > & faceLocations,
@@ -939,8 +969,6 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   arrayView1d< localIndex const > const & parentFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
   arrayView1d< localIndex const > const & childFaceIndices = faceManager.getExtrinsicData< extrinsicMeshData::ChildIndex >();
 
-  std::set< localIndex > const & vNodeToRupturedFaces = nodesToRupturedFaces[parentNodeIndex];
-
   ArrayOfSetsView< localIndex const > const & nodeToEdgeMap = nodeManager.edgeList().toViewConst();
   ArrayOfSetsView< localIndex const > const & nodeToFaceMap = nodeManager.faceList().toViewConst();
 
@@ -983,7 +1011,7 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   {
     const localIndex parentFaceIndex = ( parentFaceIndices[i] == -1 ) ? i : parentFaceIndices[i];
 
-    if( vNodeToRupturedFaces.count( parentFaceIndex ) > 0 )
+    if( nodesToRupturedFaces.contains( parentNodeIndex, parentFaceIndex ) )
     {
       nodeToRuptureReadyFaces.insert( parentFaceIndex );
     }
@@ -994,8 +1022,11 @@ bool SurfaceGenerator::FindFracturePlanes( const localIndex nodeID,
   map< localIndex, std::set< localIndex > > edgesToRuptureReadyFaces;
   for( localIndex const edgeIndex : m_originalNodetoEdges[ parentNodeIndex ] )
   {
-    if( !(edgesToRupturedFaces[edgeIndex].empty()) )
-      edgesToRuptureReadyFaces[edgeIndex].insert( edgesToRupturedFaces[edgeIndex].begin(), edgesToRupturedFaces[edgeIndex].end() );
+    if( edgesToRupturedFaces.sizeOfSet( edgeIndex ) > 0 )
+    {
+      arraySlice1d< localIndex const > const & rupturedFaces = edgesToRupturedFaces[edgeIndex];
+      edgesToRuptureReadyFaces[edgeIndex].insert( rupturedFaces.begin(), rupturedFaces.end() );
+    }
   }
 
 
@@ -1595,8 +1626,8 @@ void SurfaceGenerator::PerformFracture( const localIndex nodeID,
                                         FaceManager & faceManager,
                                         ElementRegionManager & elementManager,
                                         ModifiedObjectLists & modifiedObjects,
-                                        std::vector< std::set< localIndex > > & GEOSX_UNUSED_PARAM( nodesToRupturedFaces ),
-                                        std::vector< std::set< localIndex > > & GEOSX_UNUSED_PARAM( edgesToRupturedFaces ),
+                                        ArrayOfSetsView< localIndex const > const & GEOSX_UNUSED_PARAM( nodesToRupturedFaces ),
+                                        ArrayOfSetsView< localIndex const > const & GEOSX_UNUSED_PARAM( edgesToRupturedFaces ),
                                         const std::set< localIndex > & separationPathFaces,
                                         const map< localIndex, int > & edgeLocations,
                                         const map< localIndex, int > & faceLocations,
@@ -2933,6 +2964,8 @@ void SurfaceGenerator::CalculateNodeAndFaceSIF( DomainPartition & domain,
                 R1Tensor temp;
                 R1Tensor xEle = elementCenter[ei];
 
+                GEOSX_ERROR_IF( dNdX[er][esr].size( 0 ) == 0,
+                                "The nodal force calculation needs stored shape function derivatives, which are not kept when building with ENABLE_FE_GRADIENTS_ON_THE_FLY" );
                 SolidMechanicsLagrangianFEMKernels::ExplicitKernel::
                   CalculateSingleNodalForce( ei,
                                              n,
@@ -3731,6 +3764,8 @@ int SurfaceGenerator::CalculateElementForcesOnEdge( DomainPartition & domain,
                                             // times for the same element.
 
             //wu40: the nodal force need to be weighted by Young's modulus and possion's ratio.
+            GEOSX_ERROR_IF( dNdX[er][esr].size( 0 ) == 0,
+                            "The nodal force calculation needs stored shape function derivatives, which are not kept when building with ENABLE_FE_GRADIENTS_ON_THE_FLY" );
             SolidMechanicsLagrangianFEMKernels::ExplicitKernel::
               CalculateSingleNodalForce( ei,
                                          n,
@@ -4202,45 +4237,89 @@ void SurfaceGenerator::MarkRuptureFaceFromEdge ( localIndex const edgeID,
   }
 }
 
+/**
+ * @brief Build, for each node or edge, the sorted set of ruptured faces attached to it.
+ * @param faceToObjectMap The face to node or face to edge map.
+ * @param numObjects The number of nodes or edges.
+ * @param faceRuptureState The rupture state of the faces.
+ * @param faceParentIndex The parent index of the faces. Ruptured child faces are recorded through their parent.
+ * @param objectToRupturedFaces The resulting map.
+ */
+static void BuildToRupturedFacesMap( ArrayOfArraysView< localIndex const > const & faceToObjectMap,
+                                     localIndex const numObjects,
+                                     arrayView1d< integer const > const & faceRuptureState,
+                                     arrayView1d< localIndex const > const & faceParentIndex,
+                                     ArrayOfSets< localIndex > & objectToRupturedFaces )
+{
+  // Count the ruptured faces of each object, so that the temporary is sized exactly.
+  array1d< localIndex > numRupturedFaces( numObjects );
+  arrayView1d< localIndex > const & numRupturedFacesView = numRupturedFaces.toView();
+  forAll< parallelHostPolicy >( faceToObjectMap.size(), [=]( localIndex const kf )
+  {
+    if( faceRuptureState[kf] > 0 )
+    {
+      for( localIndex a=0; a<faceToObjectMap.sizeOfArray( kf ); ++a )
+      {
+        RAJA::atomicAdd( parallelHostAtomic{}, &numRupturedFacesView[ faceToObjectMap( kf, a ) ], localIndex( 1 ) );
+      }
+    }
+  } );
+
+  ArrayOfArrays< localIndex > rupturedFacesTemp;
+  rupturedFacesTemp.resizeFromCapacities< parallelHostPolicy >( numObjects, numRupturedFaces.data() );
+  forAll< parallelHostPolicy >( faceToObjectMap.size(), [&]( localIndex const kf )
+  {
+    if( faceRuptureState[kf] > 0 )
+    {
+      localIndex const faceIndex = faceParentIndex[kf]==-1 ? kf : faceParentIndex[kf];
+      for( localIndex a=0; a<faceToObjectMap.sizeOfArray( kf ); ++a )
+      {
+        rupturedFacesTemp.emplaceBackAtomic< parallelHostAtomic >( faceToObjectMap( kf, a ), faceIndex );
+      }
+    }
+  } );
+
+  objectToRupturedFaces.resize( 0 );
+  objectToRupturedFaces.reserve( numObjects );
+  for( localIndex i=0; i<numObjects; ++i )
+  {
+    objectToRupturedFaces.appendSet( rupturedFacesTemp.sizeOfArray( i ) );
+  }
+
+  ArrayOfSetsView< localIndex > const & objectToRupturedFacesView = objectToRupturedFaces.toView();
+  forAll< parallelHostPolicy >( numObjects, [&]( localIndex const i )
+  {
+    localIndex * const faces = rupturedFacesTemp[ i ];
+    localIndex const numFaces = rupturedFacesTemp.sizeOfArray( i );
+    localIndex const numUniqueFaces = LvArray::sortedArrayManipulation::makeSortedUnique( faces, faces + numFaces );
+    objectToRupturedFacesView.insertIntoSet( i, faces, faces + numUniqueFaces );
+  } );
+}
+
 void SurfaceGenerator::PostUpdateRuptureStates( NodeManager & nodeManager,
                                                 EdgeManager & edgeManager,
                                                 FaceManager & faceManager,
                                                 ElementRegionManager & GEOSX_UNUSED_PARAM( elementManager ),
-                                                std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                                std::vector< std::set< localIndex > > & edgesToRupturedFaces )
+                                                ArrayOfSets< localIndex > & nodesToRupturedFaces,
+                                                ArrayOfSets< localIndex > & edgesToRupturedFaces )
 {
-  ArrayOfArraysView< localIndex const > const & faceToNodeMap = faceManager.nodeList().toViewConst();
-  ArrayOfArraysView< localIndex const > const & faceToEdgeMap = faceManager.edgeList().toViewConst();
-  nodesToRupturedFaces.resize( nodeManager.size() );
-  edgesToRupturedFaces.resize( edgeManager.size() );
+  GEOSX_MARK_FUNCTION;
 
   arrayView1d< integer const > const & faceRuptureState = faceManager.getExtrinsicData< extrinsicMeshData::RuptureState >();
   arrayView1d< localIndex const > const & faceParentIndex = faceManager.getExtrinsicData< extrinsicMeshData::ParentIndex >();
 
   // assign the values of the nodeToRupturedFaces and edgeToRupturedFaces arrays.
-  for( localIndex kf=0; kf<faceManager.size(); ++kf )
-  {
-    if( faceRuptureState[kf] >0 )
-    {
-      int const n = faceParentIndex[kf]==-1 ? 1 : 2;
-      localIndex const faceIndex = faceParentIndex[kf]==-1 ? kf : faceParentIndex[kf];
-
-      for( int i=0; i<n; ++i )
-      {
-        for( localIndex a=0; a<faceToNodeMap.sizeOfArray( kf ); ++a )
-        {
-          const localIndex nodeIndex = faceToNodeMap( kf, a );
-          nodesToRupturedFaces[nodeIndex].insert( faceIndex );
-        }
-
-        for( localIndex a=0; a<faceToEdgeMap.sizeOfArray( kf ); ++a )
-        {
-          const localIndex edgeIndex = faceToEdgeMap( kf, a );
-          edgesToRupturedFaces[edgeIndex].insert( faceIndex );
-        }
-      }
-    }
-  }
+  BuildToRupturedFacesMap( faceManager.nodeList().toViewConst(),
+                           nodeManager.size(),
+                           faceRuptureState,
+                           faceParentIndex,
+                           nodesToRupturedFaces );
+
+  BuildToRupturedFacesMap( faceManager.edgeList().toViewConst(),
+                           edgeManager.size(),
+                           faceRuptureState,
+                           faceParentIndex,
+                           edgesToRupturedFaces );
 }
 
 int SurfaceGenerator::CheckEdgeSplitability( localIndex const edgeID,
@@ -262,8 +262,8 @@ private:
                                 EdgeManager & edgeManager,
                                 FaceManager & faceManager,
                                 ElementRegionManager & elementManager,
-                                std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                                std::vector< std::set< localIndex > > & edgesToRupturedFaces );
+                                ArrayOfSets< localIndex > & nodesToRupturedFaces,
+                                ArrayOfSets< localIndex > & edgesToRupturedFaces );
 
   /**
    *
@@ -313,8 +313,8 @@ private:
                     EdgeManager & edgeManager,
                     FaceManager & faceManager,
                     ElementRegionManager & elemManager,
-                    std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                    std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                    ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                    ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                     ElementRegionManager & elementManager,
                     ModifiedObjectLists & modifiedObjects,
                     const bool prefrac );
@@ -339,8 +339,8 @@ private:
                            const EdgeManager & edgeManager,
                            const FaceManager & faceManager,
                            ElementRegionManager & elemManager,
-                           const std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                           const std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                           ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                           ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                            std::set< localIndex > & separationPathFaces,
                            map< localIndex, int > & edgeLocations,
                            map< localIndex, int > & faceLocations,
@@ -369,8 +369,8 @@ private:
                         FaceManager & faceManager,
                         ElementRegionManager & elementManager,
                         ModifiedObjectLists & modifiedObjects,
-                        std::vector< std::set< localIndex > > & nodesToRupturedFaces,
-                        std::vector< std::set< localIndex > > & edgesToRupturedFaces,
+                        ArrayOfSetsView< localIndex const > const & nodesToRupturedFaces,
+                        ArrayOfSetsView< localIndex const > const & edgesToRupturedFaces,
                         const std::set< localIndex > & separationPathFaces,
                         const map< localIndex, int > & edgeLocations,
                         const map< localIndex, int > & faceLocations,
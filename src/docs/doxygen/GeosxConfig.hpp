@@ -41,6 +41,9 @@
 /// Enables use of CUDA (CMake option ENABLE_CUDA)
 #define GEOSX_USE_CUDA
 
+/// Computes the shape function derivatives in the finite element kernels instead of storing them (CMake option ENABLE_FE_GRADIENTS_ON_THE_FLY)
+#define GEOSX_USE_FE_GRADIENTS_ON_THE_FLY
+
 /// Enables use of Python (CMake option ENABLE_PYTHON)
 #define GEOSX_USE_PYTHON
 